@@ -0,0 +1,209 @@
+
+#pragma once
+
+
+#include <cstddef>
+#include <type_traits>
+#include <utility>
+
+#include <cppexpose/cppexpose_api.h>
+#include <cppexpose/cppexpose_features.h>
+#include <cppexpose/base/template_helpers.h>
+
+
+namespace cppexpose
+{
+
+
+template <typename Signature>
+class Delegate;
+
+
+/**
+*  @brief
+*    Lightweight function object
+*
+*    Delegate can store any callable object with a matching signature, like
+*    std::function. Callables of up to inlineSize bytes (function pointers,
+*    lambdas that capture an object and a member function pointer, and even
+*    a std::function) are stored inside the delegate, so creating and copying
+*    such a delegate never allocates memory. Larger callables are stored on the heap.
+*
+*    Calling a delegate is a single indirect call to the stored callable.
+*/
+template <typename R, typename... Args>
+class CPPEXPOSE_TEMPLATE_API Delegate<R (Args...)>
+{
+public:
+    static const size_t inlineSize = 4 * sizeof(void *); ///< Maximum size of callables that are stored inline
+
+
+public:
+    /**
+    *  @brief
+    *    Constructor (empty delegate)
+    */
+    Delegate();
+
+    /**
+    *  @brief
+    *    Constructor (empty delegate)
+    */
+    Delegate(std::nullptr_t);
+
+    /**
+    *  @brief
+    *    Constructor
+    *
+    *  @param[in] function
+    *    Callable object (e.g., function pointer, lambda, or function object)
+    */
+    template <typename F, typename = helper::EnableIf<helper::And<
+        helper::Neg<std::is_same<typename std::decay<F>::type, Delegate>>::value,
+        helper::isCallable<typename std::decay<F>::type, R, Args...>::value>>>
+    Delegate(F && function);
+
+    /**
+    *  @brief
+    *    Copy constructor
+    *
+    *  @param[in] other
+    *    Delegate to copy
+    */
+    Delegate(const Delegate & other);
+
+    /**
+    *  @brief
+    *    Move constructor
+    *
+    *  @param[in] other
+    *    Delegate to move (empty afterwards)
+    */
+    Delegate(Delegate && other) CPPEXPOSE_NOEXCEPT;
+
+    /**
+    *  @brief
+    *    Destructor
+    */
+    ~Delegate();
+
+    /**
+    *  @brief
+    *    Copy operator
+    *
+    *  @param[in] other
+    *    Delegate to copy
+    *
+    *  @return
+    *    Reference to this object
+    */
+    Delegate & operator=(const Delegate & other);
+
+    /**
+    *  @brief
+    *    Move operator
+    *
+    *  @param[in] other
+    *    Delegate to move (empty afterwards)
+    *
+    *  @return
+    *    Reference to this object
+    */
+    Delegate & operator=(Delegate && other) CPPEXPOSE_NOEXCEPT;
+
+    /**
+    *  @brief
+    *    Check if a callable is stored
+    *
+    *  @return
+    *    'true' if delegate is not empty, else 'false'
+    */
+    explicit operator bool() const;
+
+    /**
+    *  @brief
+    *    Call the stored callable
+    *
+    *  @param[in] args
+    *    Arguments
+    *
+    *  @return
+    *    Return value of the callable
+    *
+    *  @remarks
+    *    The delegate must not be empty.
+    */
+    R operator()(Args... args) const;
+
+
+protected:
+    using Storage = typename std::aligned_storage<inlineSize, std::alignment_of<void *>::value>::type;
+
+    /**
+    *  @brief
+    *    Operation on a stored callable
+    */
+    enum class Operation
+    {
+        Copy,    ///< Copy callable from source to target
+        Move,    ///< Move callable from source to target and destroy source
+        Destroy  ///< Destroy callable in target
+    };
+
+    using Invoke = R (*)(const Storage & storage, Args &&... args);
+    using Manage = void (*)(Operation operation, Storage & target, const Storage & source);
+
+    /**
+    *  @brief
+    *    Functions for a callable that is stored inline
+    */
+    template <typename F>
+    struct InlineCallable
+    {
+        static R invoke(const Storage & storage, Args &&... args);
+        static void manage(Operation operation, Storage & target, const Storage & source);
+    };
+
+    /**
+    *  @brief
+    *    Functions for a callable that is stored on the heap
+    */
+    template <typename F>
+    struct HeapCallable
+    {
+        static R invoke(const Storage & storage, Args &&... args);
+        static void manage(Operation operation, Storage & target, const Storage & source);
+    };
+
+    /**
+    *  @brief
+    *    Check if a callable can be stored inline
+    */
+    template <typename F>
+    struct IsInline : public std::integral_constant<bool,
+        sizeof(F) <= inlineSize &&
+        std::alignment_of<F>::value <= std::alignment_of<Storage>::value &&
+        std::is_nothrow_move_constructible<F>::value>
+    {
+    };
+
+    template <typename F>
+    void init(F && function, std::true_type isInline);
+
+    template <typename F>
+    void init(F && function, std::false_type isInline);
+
+    void reset();
+
+
+protected:
+    Storage m_storage; ///< Callable object (or pointer to it)
+    Invoke  m_invoke;  ///< Function to call the callable (nullptr if empty)
+    Manage  m_manage;  ///< Function to copy, move, and destroy the callable (nullptr if empty)
+};
+
+
+} // namespace cppexpose
+
+
+#include <cppexpose/base/Delegate.inl>
@@ -0,0 +1,220 @@
+
+#pragma once
+
+
+#include <new>
+
+
+namespace cppexpose
+{
+
+
+template <typename R, typename... Args>
+Delegate<R (Args...)>::Delegate()
+: m_invoke(nullptr)
+, m_manage(nullptr)
+{
+}
+
+template <typename R, typename... Args>
+Delegate<R (Args...)>::Delegate(std::nullptr_t)
+: m_invoke(nullptr)
+, m_manage(nullptr)
+{
+}
+
+template <typename R, typename... Args>
+template <typename F, typename>
+Delegate<R (Args...)>::Delegate(F && function)
+: m_invoke(nullptr)
+, m_manage(nullptr)
+{
+    using Callable = typename std::decay<F>::type;
+
+    init(std::forward<F>(function), IsInline<Callable>());
+}
+
+template <typename R, typename... Args>
+Delegate<R (Args...)>::Delegate(const Delegate & other)
+: m_invoke(other.m_invoke)
+, m_manage(other.m_manage)
+{
+    if (m_manage) {
+        m_manage(Operation::Copy, m_storage, other.m_storage);
+    }
+}
+
+template <typename R, typename... Args>
+Delegate<R (Args...)>::Delegate(Delegate && other) CPPEXPOSE_NOEXCEPT
+: m_invoke(other.m_invoke)
+, m_manage(other.m_manage)
+{
+    if (m_manage)
+    {
+        m_manage(Operation::Move, m_storage, other.m_storage);
+
+        other.m_invoke = nullptr;
+        other.m_manage = nullptr;
+    }
+}
+
+template <typename R, typename... Args>
+Delegate<R (Args...)>::~Delegate()
+{
+    reset();
+}
+
+template <typename R, typename... Args>
+Delegate<R (Args...)> & Delegate<R (Args...)>::operator=(const Delegate & other)
+{
+    if (this != &other)
+    {
+        reset();
+
+        if (other.m_manage) {
+            other.m_manage(Operation::Copy, m_storage, other.m_storage);
+        }
+
+        m_invoke = other.m_invoke;
+        m_manage = other.m_manage;
+    }
+
+    return *this;
+}
+
+template <typename R, typename... Args>
+Delegate<R (Args...)> & Delegate<R (Args...)>::operator=(Delegate && other) CPPEXPOSE_NOEXCEPT
+{
+    if (this != &other)
+    {
+        reset();
+
+        if (other.m_manage) {
+            other.m_manage(Operation::Move, m_storage, other.m_storage);
+        }
+
+        m_invoke = other.m_invoke;
+        m_manage = other.m_manage;
+
+        other.m_invoke = nullptr;
+        other.m_manage = nullptr;
+    }
+
+    return *this;
+}
+
+template <typename R, typename... Args>
+Delegate<R (Args...)>::operator bool() const
+{
+    return m_invoke != nullptr;
+}
+
+template <typename R, typename... Args>
+R Delegate<R (Args...)>::operator()(Args... args) const
+{
+    return m_invoke(m_storage, std::forward<Args>(args)...);
+}
+
+template <typename R, typename... Args>
+template <typename F>
+void Delegate<R (Args...)>::init(F && function, std::true_type)
+{
+    using Callable = typename std::decay<F>::type;
+
+    ::new (static_cast<void *>(&m_storage)) Callable(std::forward<F>(function));
+
+    m_invoke = &InlineCallable<Callable>::invoke;
+    m_manage = &InlineCallable<Callable>::manage;
+}
+
+template <typename R, typename... Args>
+template <typename F>
+void Delegate<R (Args...)>::init(F && function, std::false_type)
+{
+    using Callable = typename std::decay<F>::type;
+
+    *reinterpret_cast<Callable **>(&m_storage) = new Callable(std::forward<F>(function));
+
+    m_invoke = &HeapCallable<Callable>::invoke;
+    m_manage = &HeapCallable<Callable>::manage;
+}
+
+template <typename R, typename... Args>
+void Delegate<R (Args...)>::reset()
+{
+    if (m_manage) {
+        m_manage(Operation::Destroy, m_storage, m_storage);
+    }
+
+    m_invoke = nullptr;
+    m_manage = nullptr;
+}
+
+template <typename R, typename... Args>
+template <typename F>
+R Delegate<R (Args...)>::InlineCallable<F>::invoke(const Storage & storage, Args &&... args)
+{
+    // Callables may have a non-const call operator, like in std::function
+    F & function = const_cast<F &>(reinterpret_cast<const F &>(storage));
+
+    return static_cast<R>(function(std::forward<Args>(args)...));
+}
+
+template <typename R, typename... Args>
+template <typename F>
+void Delegate<R (Args...)>::InlineCallable<F>::manage(Operation operation, Storage & target, const Storage & source)
+{
+    F & function = const_cast<F &>(reinterpret_cast<const F &>(source));
+
+    switch (operation)
+    {
+        case Operation::Copy:
+            ::new (static_cast<void *>(&target)) F(function);
+            break;
+
+        case Operation::Move:
+            ::new (static_cast<void *>(&target)) F(std::move(function));
+            function.~F();
+            break;
+
+        case Operation::Destroy:
+        default:
+            reinterpret_cast<F &>(target).~F();
+            break;
+    }
+}
+
+template <typename R, typename... Args>
+template <typename F>
+R Delegate<R (Args...)>::HeapCallable<F>::invoke(const Storage & storage, Args &&... args)
+{
+    F * function = *reinterpret_cast<F * const *>(&storage);
+
+    return static_cast<R>((*function)(std::forward<Args>(args)...));
+}
+
+template <typename R, typename... Args>
+template <typename F>
+void Delegate<R (Args...)>::HeapCallable<F>::manage(Operation operation, Storage & target, const Storage & source)
+{
+    F * function = *reinterpret_cast<F * const *>(&source);
+
+    switch (operation)
+    {
+        case Operation::Copy:
+            *reinterpret_cast<F **>(&target) = new F(*function);
+            break;
+
+        case Operation::Move:
+            *reinterpret_cast<F **>(&target) = function;
+            break;
+
+        case Operation::Destroy:
+        default:
+            delete *reinterpret_cast<F **>(&target);
+            break;
+    }
+}
+
+
+} // namespace cppexpose
@@ -0,0 +1,381 @@
+
+#pragma once
+
+
+#include <cstddef>
+#include <vector>
+#include <utility>
+#include <iterator>
+#include <functional>
+#include <initializer_list>
+
+#include <cppexpose/cppexpose_api.h>
+
+
+namespace cppexpose
+{
+
+
+/**
+*  @brief
+*    Associative container that stores its entries in a sorted vector
+*
+*    FlatMap provides the commonly used subset of the std::map interface.
+*    The entries are stored contiguously and sorted by their key, so they are
+*    iterated in the same order as in a std::map. Lookups are performed by binary
+*    search, which is more cache friendly than traversing the nodes of a tree.
+*
+*    In contrast to std::map, inserting or erasing entries invalidates all
+*    iterators and references to entries of the map.
+*
+*    Like in std::map, entries are stored as std::pair<const Key, Value>,
+*    so keys cannot be changed through iterators, which would break the
+*    sort order. Since such entries cannot be assigned, they are moved into
+*    a new vector when inserting or erasing anywhere but at the end, instead
+*    of being shifted in place.
+*/
+template <typename Key, typename Value, typename Compare = std::less<Key>>
+class CPPEXPOSE_TEMPLATE_API FlatMap
+{
+protected:
+    using container_type = std::vector<std::pair<const Key, Value>>;
+
+
+public:
+    using key_type       = Key;
+    using mapped_type    = Value;
+    using value_type     = std::pair<const Key, Value>;
+    using key_compare    = Compare;
+    using size_type      = typename container_type::size_type;
+    using iterator       = typename container_type::iterator;
+    using const_iterator = typename container_type::const_iterator;
+
+
+public:
+    /**
+    *  @brief
+    *    Constructor
+    */
+    FlatMap();
+
+    /**
+    *  @brief
+    *    Constructor
+    *
+    *  @param[in] values
+    *    Initial entries (for duplicate keys, the first entry is used)
+    */
+    FlatMap(std::initializer_list<value_type> values);
+
+    /**
+    *  @brief
+    *    Copy constructor
+    *
+    *  @param[in] other
+    *    Map that is copied
+    */
+    FlatMap(const FlatMap & other) = default;
+
+    /**
+    *  @brief
+    *    Move constructor
+    *
+    *  @param[in] other
+    *    Map that is moved
+    */
+    FlatMap(FlatMap && other) = default;
+
+    /**
+    *  @brief
+    *    Copy operator
+    *
+    *  @param[in] other
+    *    Map that is copied
+    *
+    *  @return
+    *    Reference to this map
+    *
+    *  @remarks
+    *    The entries are copied into a new vector, because entries
+    *    with const keys cannot be assigned.
+    */
+    FlatMap & operator=(const FlatMap & other);
+
+    /**
+    *  @brief
+    *    Move operator
+    *
+    *  @param[in] other
+    *    Map that is moved
+    *
+    *  @return
+    *    Reference to this map
+    */
+    FlatMap & operator=(FlatMap && other) = default;
+
+    //@{
+    /**
+    *  @brief
+    *    Get iterator to the first entry
+    *
+    *  @return
+    *    Iterator
+    */
+    iterator begin();
+    const_iterator begin() const;
+    const_iterator cbegin() const;
+    //@}
+
+    //@{
+    /**
+    *  @brief
+    *    Get iterator behind the last entry
+    *
+    *  @return
+    *    Iterator
+    */
+    iterator end();
+    const_iterator end() const;
+    const_iterator cend() const;
+    //@}
+
+    /**
+    *  @brief
+    *    Check if map is empty
+    *
+    *  @return
+    *    'true' if map has no entries, else 'false'
+    */
+    bool empty() const;
+
+    /**
+    *  @brief
+    *    Get number of entries
+    *
+    *  @return
+    *    Number of entries
+    */
+    size_type size() const;
+
+    /**
+    *  @brief
+    *    Reserve memory for entries
+    *
+    *  @param[in] count
+    *    Number of entries
+    */
+    void reserve(size_type count);
+
+    /**
+    *  @brief
+    *    Remove all entries
+    */
+    void clear();
+
+    //@{
+    /**
+    *  @brief
+    *    Get value for key, insert a default value if the key does not exist
+    *
+    *  @param[in] key
+    *    Key
+    *
+    *  @return
+    *    Reference to value
+    */
+    Value & operator[](const Key & key);
+    Value & operator[](Key && key);
+    //@}
+
+    //@{
+    /**
+    *  @brief
+    *    Get value for key
+    *
+    *  @param[in] key
+    *    Key
+    *
+    *  @return
+    *    Reference to value
+    *
+    *  @remarks
+    *    Throws std::out_of_range if the key does not exist, like std::map::at().
+    */
+    Value & at(const Key & key);
+    const Value & at(const Key & key) const;
+    //@}
+
+    //@{
+    /**
+    *  @brief
+    *    Find entry
+    *
+    *  @param[in] key
+    *    Key
+    *
+    *  @return
+    *    Iterator to the entry, end() if the key does not exist
+    */
+    iterator find(const Key & key);
+    const_iterator find(const Key & key) const;
+    //@}
+
+    //@{
+    /**
+    *  @brief
+    *    Get first entry whose key is not less than the given key
+    *
+    *  @param[in] key
+    *    Key
+    *
+    *  @return
+    *    Iterator to the entry, end() if there is no such entry
+    */
+    iterator lower_bound(const Key & key);
+    const_iterator lower_bound(const Key & key) const;
+    //@}
+
+    /**
+    *  @brief
+    *    Get number of entries with the given key
+    *
+    *  @param[in] key
+    *    Key
+    *
+    *  @return
+    *    1 if the key exists, else 0
+    */
+    size_type count(const Key & key) const;
+
+    //@{
+    /**
+    *  @brief
+    *    Insert entry if its key does not exist yet
+    *
+    *  @param[in] value
+    *    Entry
+    *
+    *  @return
+    *    Iterator to the entry with the key and 'true' if the entry has been inserted
+    */
+    std::pair<iterator, bool> insert(const value_type & value);
+    std::pair<iterator, bool> insert(value_type && value);
+    //@}
+
+    /**
+    *  @brief
+    *    Construct and insert entry if its key does not exist yet
+    *
+    *  @param[in] args
+    *    Arguments for the construction of the entry
+    *
+    *  @return
+    *    Iterator to the entry with the key and 'true' if the entry has been inserted
+    */
+    template <typename... Args>
+    std::pair<iterator, bool> emplace(Args &&... args);
+
+    //@{
+    /**
+    *  @brief
+    *    Remove entry
+    *
+    *  @param[in] pos
+    *    Iterator to the entry
+    *
+    *  @return
+    *    Iterator to the entry following the removed entry
+    */
+    iterator erase(iterator pos);
+    iterator erase(const_iterator pos);
+    //@}
+
+    /**
+    *  @brief
+    *    Remove entry
+    *
+    *  @param[in] key
+    *    Key
+    *
+    *  @return
+    *    Number of removed entries (0 or 1)
+    */
+    size_type erase(const Key & key);
+
+    /**
+    *  @brief
+    *    Compare maps
+    *
+    *  @param[in] other
+    *    Map to compare with
+    *
+    *  @return
+    *    'true' if both maps contain the same entries, else 'false'
+    */
+    bool operator==(const FlatMap & other) const;
+
+    /**
+    *  @brief
+    *    Compare maps
+    *
+    *  @param[in] other
+    *    Map to compare with
+    *
+    *  @return
+    *    'true' if the maps contain different entries, else 'false'
+    */
+    bool operator!=(const FlatMap & other) const;
+
+
+protected:
+    /**
+    *  @brief
+    *    Check if iterator points to an entry with the given key
+    *
+    *  @param[in] it
+    *    Iterator (e.g., returned by lower_bound())
+    *  @param[in] key
+    *    Key
+    *
+    *  @return
+    *    'true' if the entry has the key, else 'false'
+    */
+    bool matches(const_iterator it, const Key & key) const;
+
+    /**
+    *  @brief
+    *    Insert entry at position
+    *
+    *  @param[in] pos
+    *    Position (must keep the entries sorted)
+    *  @param[in] entry
+    *    Entry
+    *
+    *  @return
+    *    Iterator to the inserted entry
+    */
+    iterator insertAt(iterator pos, value_type && entry);
+
+    /**
+    *  @brief
+    *    Remove entry at position
+    *
+    *  @param[in] pos
+    *    Iterator to the entry
+    *
+    *  @return
+    *    Iterator to the entry following the removed entry
+    */
+    iterator eraseAt(iterator pos);
+
+
+protected:
+    container_type m_entries; ///< Entries, sorted by key
+    Compare        m_compare; ///< Key comparison
+};
+
+
+} // namespace cppexpose
+
+
+#include <cppexpose/base/FlatMap.inl>
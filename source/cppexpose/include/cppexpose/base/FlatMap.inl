@@ -0,0 +1,326 @@
+
+#pragma once
+
+
+#include <algorithm>
+#include <stdexcept>
+
+
+namespace cppexpose
+{
+
+
+template <typename Key, typename Value, typename Compare>
+FlatMap<Key, Value, Compare>::FlatMap()
+{
+}
+
+template <typename Key, typename Value, typename Compare>
+FlatMap<Key, Value, Compare>::FlatMap(std::initializer_list<value_type> values)
+{
+    m_entries.reserve(values.size());
+
+    for (const auto & value : values)
+    {
+        insert(value);
+    }
+}
+
+template <typename Key, typename Value, typename Compare>
+FlatMap<Key, Value, Compare> & FlatMap<Key, Value, Compare>::operator=(const FlatMap & other)
+{
+    if (this != &other)
+    {
+        container_type entries(other.m_entries);
+        m_entries.swap(entries);
+        m_compare = other.m_compare;
+    }
+
+    return *this;
+}
+
+template <typename Key, typename Value, typename Compare>
+typename FlatMap<Key, Value, Compare>::iterator FlatMap<Key, Value, Compare>::begin()
+{
+    return iterator(m_entries.begin());
+}
+
+template <typename Key, typename Value, typename Compare>
+typename FlatMap<Key, Value, Compare>::const_iterator FlatMap<Key, Value, Compare>::begin() const
+{
+    return const_iterator(m_entries.begin());
+}
+
+template <typename Key, typename Value, typename Compare>
+typename FlatMap<Key, Value, Compare>::const_iterator FlatMap<Key, Value, Compare>::cbegin() const
+{
+    return const_iterator(m_entries.cbegin());
+}
+
+template <typename Key, typename Value, typename Compare>
+typename FlatMap<Key, Value, Compare>::iterator FlatMap<Key, Value, Compare>::end()
+{
+    return iterator(m_entries.end());
+}
+
+template <typename Key, typename Value, typename Compare>
+typename FlatMap<Key, Value, Compare>::const_iterator FlatMap<Key, Value, Compare>::end() const
+{
+    return const_iterator(m_entries.end());
+}
+
+template <typename Key, typename Value, typename Compare>
+typename FlatMap<Key, Value, Compare>::const_iterator FlatMap<Key, Value, Compare>::cend() const
+{
+    return const_iterator(m_entries.cend());
+}
+
+template <typename Key, typename Value, typename Compare>
+bool FlatMap<Key, Value, Compare>::empty() const
+{
+    return m_entries.empty();
+}
+
+template <typename Key, typename Value, typename Compare>
+typename FlatMap<Key, Value, Compare>::size_type FlatMap<Key, Value, Compare>::size() const
+{
+    return m_entries.size();
+}
+
+template <typename Key, typename Value, typename Compare>
+void FlatMap<Key, Value, Compare>::reserve(size_type count)
+{
+    m_entries.reserve(count);
+}
+
+template <typename Key, typename Value, typename Compare>
+void FlatMap<Key, Value, Compare>::clear()
+{
+    m_entries.clear();
+}
+
+template <typename Key, typename Value, typename Compare>
+Value & FlatMap<Key, Value, Compare>::operator[](const Key & key)
+{
+    auto it = lower_bound(key);
+
+    if (!matches(it, key))
+    {
+        it = insertAt(it, value_type(key, Value()));
+    }
+
+    return it->second;
+}
+
+template <typename Key, typename Value, typename Compare>
+Value & FlatMap<Key, Value, Compare>::operator[](Key && key)
+{
+    auto it = lower_bound(key);
+
+    if (!matches(it, key))
+    {
+        it = insertAt(it, value_type(std::move(key), Value()));
+    }
+
+    return it->second;
+}
+
+template <typename Key, typename Value, typename Compare>
+Value & FlatMap<Key, Value, Compare>::at(const Key & key)
+{
+    auto it = find(key);
+
+    if (it == end())
+    {
+        throw std::out_of_range("FlatMap::at(): key not found");
+    }
+
+    return it->second;
+}
+
+template <typename Key, typename Value, typename Compare>
+const Value & FlatMap<Key, Value, Compare>::at(const Key & key) const
+{
+    auto it = find(key);
+
+    if (it == end())
+    {
+        throw std::out_of_range("FlatMap::at(): key not found");
+    }
+
+    return it->second;
+}
+
+template <typename Key, typename Value, typename Compare>
+typename FlatMap<Key, Value, Compare>::iterator FlatMap<Key, Value, Compare>::find(const Key & key)
+{
+    auto it = lower_bound(key);
+    return matches(it, key) ? it : m_entries.end();
+}
+
+template <typename Key, typename Value, typename Compare>
+typename FlatMap<Key, Value, Compare>::const_iterator FlatMap<Key, Value, Compare>::find(const Key & key) const
+{
+    auto it = lower_bound(key);
+    return matches(it, key) ? it : m_entries.end();
+}
+
+template <typename Key, typename Value, typename Compare>
+typename FlatMap<Key, Value, Compare>::iterator FlatMap<Key, Value, Compare>::lower_bound(const Key & key)
+{
+    const Compare & compare = m_compare;
+
+    return std::lower_bound(m_entries.begin(), m_entries.end(), key, [&compare] (const value_type & entry, const Key & key)
+    {
+        return compare(entry.first, key);
+    });
+}
+
+template <typename Key, typename Value, typename Compare>
+typename FlatMap<Key, Value, Compare>::const_iterator FlatMap<Key, Value, Compare>::lower_bound(const Key & key) const
+{
+    const Compare & compare = m_compare;
+
+    return std::lower_bound(m_entries.begin(), m_entries.end(), key, [&compare] (const value_type & entry, const Key & key)
+    {
+        return compare(entry.first, key);
+    });
+}
+
+template <typename Key, typename Value, typename Compare>
+typename FlatMap<Key, Value, Compare>::size_type FlatMap<Key, Value, Compare>::count(const Key & key) const
+{
+    return matches(lower_bound(key), key) ? 1 : 0;
+}
+
+template <typename Key, typename Value, typename Compare>
+std::pair<typename FlatMap<Key, Value, Compare>::iterator, bool> FlatMap<Key, Value, Compare>::insert(const value_type & value)
+{
+    auto it = lower_bound(value.first);
+
+    if (matches(it, value.first))
+    {
+        return std::make_pair(it, false);
+    }
+
+    return std::make_pair(insertAt(it, value_type(value)), true);
+}
+
+template <typename Key, typename Value, typename Compare>
+std::pair<typename FlatMap<Key, Value, Compare>::iterator, bool> FlatMap<Key, Value, Compare>::insert(value_type && value)
+{
+    auto it = lower_bound(value.first);
+
+    if (matches(it, value.first))
+    {
+        return std::make_pair(it, false);
+    }
+
+    return std::make_pair(insertAt(it, std::move(value)), true);
+}
+
+template <typename Key, typename Value, typename Compare>
+template <typename... Args>
+std::pair<typename FlatMap<Key, Value, Compare>::iterator, bool> FlatMap<Key, Value, Compare>::emplace(Args &&... args)
+{
+    value_type entry(std::forward<Args>(args)...);
+
+    auto it = lower_bound(entry.first);
+
+    if (matches(it, entry.first))
+    {
+        return std::make_pair(it, false);
+    }
+
+    return std::make_pair(insertAt(it, std::move(entry)), true);
+}
+
+template <typename Key, typename Value, typename Compare>
+typename FlatMap<Key, Value, Compare>::iterator FlatMap<Key, Value, Compare>::erase(iterator pos)
+{
+    return eraseAt(pos);
+}
+
+template <typename Key, typename Value, typename Compare>
+typename FlatMap<Key, Value, Compare>::iterator FlatMap<Key, Value, Compare>::erase(const_iterator pos)
+{
+    return eraseAt(m_entries.begin() + (pos - m_entries.cbegin()));
+}
+
+template <typename Key, typename Value, typename Compare>
+typename FlatMap<Key, Value, Compare>::size_type FlatMap<Key, Value, Compare>::erase(const Key & key)
+{
+    auto it = lower_bound(key);
+
+    if (!matches(it, key))
+    {
+        return 0;
+    }
+
+    eraseAt(it);
+    return 1;
+}
+
+template <typename Key, typename Value, typename Compare>
+bool FlatMap<Key, Value, Compare>::operator==(const FlatMap & other) const
+{
+    return m_entries == other.m_entries;
+}
+
+template <typename Key, typename Value, typename Compare>
+bool FlatMap<Key, Value, Compare>::operator!=(const FlatMap & other) const
+{
+    return m_entries != other.m_entries;
+}
+
+template <typename Key, typename Value, typename Compare>
+bool FlatMap<Key, Value, Compare>::matches(const_iterator it, const Key & key) const
+{
+    return it != m_entries.end() && !m_compare(key, it->first);
+}
+
+template <typename Key, typename Value, typename Compare>
+typename FlatMap<Key, Value, Compare>::iterator FlatMap<Key, Value, Compare>::insertAt(iterator pos, value_type && entry)
+{
+    if (pos == m_entries.end())
+    {
+        m_entries.push_back(std::move(entry));
+        return m_entries.end() - 1;
+    }
+
+    const auto index = pos - m_entries.begin();
+
+    // Entries cannot be shifted by assignment, so move them into a new vector
+    container_type entries;
+    entries.reserve(m_entries.size() < m_entries.capacity() ? m_entries.capacity() : 2 * m_entries.size());
+    std::move(m_entries.begin(), pos, std::back_inserter(entries));
+    entries.push_back(std::move(entry));
+    std::move(pos, m_entries.end(), std::back_inserter(entries));
+    m_entries.swap(entries);
+
+    return m_entries.begin() + index;
+}
+
+template <typename Key, typename Value, typename Compare>
+typename FlatMap<Key, Value, Compare>::iterator FlatMap<Key, Value, Compare>::eraseAt(iterator pos)
+{
+    if (pos + 1 == m_entries.end())
+    {
+        m_entries.pop_back();
+        return m_entries.end();
+    }
+
+    const auto index = pos - m_entries.begin();
+
+    // Entries cannot be shifted by assignment, so move the remaining ones into a new vector
+    container_type entries;
+    entries.reserve(m_entries.capacity());
+    std::move(m_entries.begin(), pos, std::back_inserter(entries));
+    std::move(pos + 1, m_entries.end(), std::back_inserter(entries));
+    m_entries.swap(entries);
+
+    return m_entries.begin() + index;
+}
+
+
+} // namespace cppexpose
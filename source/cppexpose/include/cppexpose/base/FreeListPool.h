@@ -0,0 +1,114 @@
+
+#pragma once
+
+
+#include <cstddef>
+
+#include <cppexpose/cppexpose_api.h>
+#include <cppexpose/cppexpose_features.h>
+
+
+namespace cppexpose
+{
+
+
+/**
+*  @brief
+*    Thread-local recycling of small memory blocks
+*
+*    Memory blocks up to maxBlockSize bytes are grouped into size classes. When a
+*    block is released, it is kept in a free list of the current thread instead of
+*    being returned to the heap, and the next allocation of the same size class on
+*    that thread reuses it without locking. This is used for objects that are created
+*    and destroyed frequently, e.g., the typed values created by AbstractTyped::clone()
+*    and the function objects created by AbstractFunction::clone().
+*
+*    Classes use the pool by deriving from PoolAllocated.
+*
+*  @remarks
+*    Blocks can be released on another thread than the one that allocated them.
+*    The number of cached blocks per size class is limited, the remaining blocks
+*    are returned to the heap. Cached blocks are released when the thread exits
+*    (or by release(), if the compiler does not support thread_local).
+*/
+class CPPEXPOSE_API FreeListPool
+{
+public:
+    static const size_t blockAlignment = 16;   ///< Granularity of size classes (in bytes)
+    static const size_t maxBlockSize   = 256;  ///< Maximum size of blocks that are recycled (in bytes)
+    static const size_t maxCachedBlocks = 256; ///< Maximum number of cached blocks per size class and thread
+
+
+public:
+    /**
+    *  @brief
+    *    Allocate memory block
+    *
+    *  @param[in] size
+    *    Size of the block (in bytes)
+    *
+    *  @return
+    *    Pointer to memory (throws std::bad_alloc on error, like operator new)
+    */
+    static void * allocate(size_t size);
+
+    /**
+    *  @brief
+    *    Release memory block
+    *
+    *  @param[in] ptr
+    *    Pointer to memory (can be null)
+    *  @param[in] size
+    *    Size of the block (in bytes, must match the allocated size)
+    */
+    static void deallocate(void * ptr, size_t size);
+
+    /**
+    *  @brief
+    *    Return all cached blocks of the current thread to the heap
+    */
+    static void release();
+
+    /**
+    *  @brief
+    *    Get number of cached blocks of the current thread
+    *
+    *  @return
+    *    Number of blocks in all free lists
+    */
+    static size_t numCachedBlocks();
+};
+
+
+/**
+*  @brief
+*    Base class for classes whose instances are allocated from the FreeListPool
+*
+*  @remarks
+*    Placement new is still available. Arrays are allocated on the heap.
+*/
+class PoolAllocated
+{
+public:
+    static void * operator new(size_t size)
+    {
+        return FreeListPool::allocate(size);
+    }
+
+    static void operator delete(void * ptr, size_t size)
+    {
+        FreeListPool::deallocate(ptr, size);
+    }
+
+    static void * operator new(size_t, void * ptr) CPPEXPOSE_NOEXCEPT
+    {
+        return ptr;
+    }
+
+    static void operator delete(void *, void *) CPPEXPOSE_NOEXCEPT
+    {
+    }
+};
+
+
+} // namespace cppexpose
@@ -0,0 +1,162 @@
+
+#pragma once
+
+
+#include <string>
+#include <functional>
+
+#include <cppexpose/cppexpose_api.h>
+
+
+namespace cppexpose
+{
+
+
+/**
+*  @brief
+*    Handle to an interned string
+*
+*    All symbols with the same content share a single string instance, which is
+*    stored in a global table. Therefore, symbols are cheap to copy, and comparing
+*    or hashing symbols only needs to look at the pointer to the shared string.
+*
+*    Interned strings are never released, so symbols should only be used for
+*    names that are reused frequently (e.g., property names), not for arbitrary data.
+*
+*  @remarks
+*    Looking up strings in the global table (lookup(), or creating a symbol
+*    for a string that has been interned before) is lock-free, only interning
+*    new strings takes a mutex. Copying and comparing symbols is lock-free.
+*/
+class CPPEXPOSE_API Symbol
+{
+public:
+    /**
+    *  @brief
+    *    Look up symbol without creating it
+    *
+    *  @param[in] str
+    *    String
+    *  @param[out] symbol
+    *    Symbol for the string (only set if the string has been interned before)
+    *
+    *  @return
+    *    'true' if a symbol for the string exists, else 'false'
+    *
+    *  @remarks
+    *    This can be used to search for names without adding them to
+    *    the global table: if no symbol exists, the name cannot be in use.
+    */
+    static bool lookup(const std::string & str, Symbol & symbol);
+
+
+public:
+    /**
+    *  @brief
+    *    Constructor (empty symbol)
+    */
+    Symbol();
+
+    //@{
+    /**
+    *  @brief
+    *    Constructor
+    *
+    *  @param[in] str
+    *    String (is interned if it has not been interned before)
+    */
+    Symbol(const std::string & str);
+    Symbol(const char * str);
+    //@}
+
+    /**
+    *  @brief
+    *    Get string
+    *
+    *  @return
+    *    String
+    */
+    const std::string & str() const;
+
+    /**
+    *  @brief
+    *    Get string
+    *
+    *  @return
+    *    String
+    */
+    operator const std::string &() const;
+
+    /**
+    *  @brief
+    *    Check if symbol is empty
+    *
+    *  @return
+    *    'true' if the symbol is an empty string, else 'false'
+    */
+    bool empty() const;
+
+    /**
+    *  @brief
+    *    Get hash value
+    *
+    *  @return
+    *    Hash value (computed from the address of the interned string)
+    */
+    size_t hash() const;
+
+    //@{
+    /**
+    *  @brief
+    *    Compare symbols by identity
+    *
+    *  @param[in] symbol
+    *    Symbol to compare with
+    *
+    *  @return
+    *    Result of the comparison
+    */
+    bool operator==(const Symbol & symbol) const;
+    bool operator!=(const Symbol & symbol) const;
+    //@}
+
+    /**
+    *  @brief
+    *    Compare symbols by their strings (for sorted containers)
+    *
+    *  @param[in] symbol
+    *    Symbol to compare with
+    *
+    *  @return
+    *    'true' if this symbol is lexicographically less than the other symbol, else 'false'
+    */
+    bool operator<(const Symbol & symbol) const;
+
+
+protected:
+    const std::string * m_string; ///< Interned string (never null)
+};
+
+
+} // namespace cppexpose
+
+
+namespace std
+{
+
+
+/**
+*  @brief
+*    Hash function for symbols
+*/
+template <>
+struct hash<cppexpose::Symbol>
+{
+    size_t operator()(const cppexpose::Symbol & symbol) const
+    {
+        return symbol.hash();
+    }
+};
+
+
+} // namespace std
@@ -0,0 +1,146 @@
+
+#pragma once
+
+
+#include <string>
+
+#include <cppexpose/cppexpose_api.h>
+
+
+namespace cppexpose
+{
+
+
+/**
+*  @brief
+*    Helpers to convert numbers from and to strings.
+*
+*    In contrast to string streams, these functions do not allocate
+*    memory for parsing and are independent of the current locale,
+*    i.e., the decimal point is always '.'. Parsing follows the rules
+*    of formatted stream input: leading whitespace is skipped, the longest
+*    valid prefix is converted, and 0 is returned if there is none.
+*/
+namespace helper
+{
+
+
+/**
+*  @brief
+*    Parse signed integer
+*
+*  @param[in] str
+*    String
+*
+*  @return
+*    Number (clamped to the range of long long)
+*/
+CPPEXPOSE_API long long parseInteger(const std::string & str);
+
+/**
+*  @brief
+*    Parse unsigned integer
+*
+*  @param[in] str
+*    String
+*
+*  @return
+*    Number (clamped to the range of unsigned long long)
+*/
+CPPEXPOSE_API unsigned long long parseUnsignedInteger(const std::string & str);
+
+/**
+*  @brief
+*    Parse character
+*
+*  @param[in] str
+*    String
+*
+*  @return
+*    First character that is not whitespace, '\0' if there is none
+*
+*  @remarks
+*    Like formatted stream input, 8-bit integers are read as characters, not as numbers.
+*/
+CPPEXPOSE_API char parseCharacter(const std::string & str);
+
+//@{
+/**
+*  @brief
+*    Parse floating point number
+*
+*  @param[in] str
+*    String
+*  @param[in] begin
+*    Pointer to the first character
+*  @param[in] end
+*    Pointer behind the last character
+*
+*  @return
+*    Number
+*/
+CPPEXPOSE_API double parseFloatingPoint(const std::string & str);
+CPPEXPOSE_API double parseFloatingPoint(const char * begin, const char * end);
+//@}
+
+/**
+*  @brief
+*    Format signed integer
+*
+*  @param[in] value
+*    Number
+*
+*  @return
+*    String
+*/
+CPPEXPOSE_API std::string formatInteger(long long value);
+
+/**
+*  @brief
+*    Format unsigned integer
+*
+*  @param[in] value
+*    Number
+*
+*  @return
+*    String
+*/
+CPPEXPOSE_API std::string formatUnsignedInteger(unsigned long long value);
+
+/**
+*  @brief
+*    Format floating point number
+*
+*  @param[in] value
+*    Number
+*  @param[in] precision
+*    Number of significant digits (the default matches string streams)
+*
+*  @return
+*    String (in the shortest of fixed or scientific notation)
+*/
+CPPEXPOSE_API std::string formatFloatingPoint(double value, int precision = 6);
+
+//@{
+/**
+*  @brief
+*    Format floating point number with the fewest digits that parse back to the same value
+*
+*  @param[in] value
+*    Number
+*
+*  @return
+*    String (in the shortest of fixed or scientific notation, "inf", "-inf", or "nan")
+*
+*  @remarks
+*    The float overload compares in single precision, so e.g. 0.1f is formatted as "0.1".
+*/
+CPPEXPOSE_API std::string formatShortestFloatingPoint(double value);
+CPPEXPOSE_API std::string formatShortestFloatingPoint(float value);
+//@}
+
+
+} // namespace helper
+
+
+} // namespace cppexpose
@@ -3,6 +3,8 @@
 
 
 #include <array>
+#include <vector>
+#include <utility>
 #include <type_traits>
 
 #include <cppexpose/cppexpose_api.h>
@@ -12,6 +14,9 @@ namespace cppexpose
 {
 
 
+class Variant;
+
+
 /**
 *  @brief
 *    Template helpers that deal with type traits and conditional template specialization.
@@ -44,12 +49,55 @@ struct CPPEXPOSE_TEMPLATE_API is_array : public std::false_type {};
 template <typename Type, size_t Size>
 struct CPPEXPOSE_TEMPLATE_API is_array<std::array<Type, Size>> : public std::true_type {};
 
+template <typename Type>
+struct CPPEXPOSE_TEMPLATE_API is_vector : public std::false_type {};
+
+template <typename Type, typename Allocator>
+struct CPPEXPOSE_TEMPLATE_API is_vector<std::vector<Type, Allocator>> : public std::true_type {};
+
+// Variant arrays are variant values, not typed vectors
+template <typename Allocator>
+struct CPPEXPOSE_TEMPLATE_API is_vector<std::vector<Variant, Allocator>> : public std::false_type {};
+
 template <typename Type, typename Container>
 struct CPPEXPOSE_TEMPLATE_API is_special_array : public std::false_type {};
 
 template <typename Type, size_t Size>
 struct CPPEXPOSE_TEMPLATE_API is_special_array<Type, std::array<Type, Size>> : public std::true_type {};
 
+template <typename Function, typename Result, typename... Arguments>
+struct CPPEXPOSE_TEMPLATE_API is_callable
+{
+    template <typename F>
+    static std::integral_constant<bool, std::is_void<Result>::value ||
+        std::is_convertible<decltype(std::declval<F &>()(std::declval<Arguments>()...)), Result>::value> test(int);
+
+    template <typename F>
+    static std::false_type test(...);
+
+    static const bool value = decltype(test<Function>(0))::value;
+};
+
+template <typename Type>
+struct CPPEXPOSE_TEMPLATE_API has_equal_operator
+{
+    template <typename T>
+    static std::integral_constant<bool,
+        std::is_convertible<decltype(std::declval<const T &>() == std::declval<const T &>()), bool>::value> test(int);
+
+    template <typename T>
+    static std::false_type test(...);
+
+    static const bool value = decltype(test<Type>(0))::value;
+};
+
+// Containers declare operator== for all element types, so check the elements instead
+template <typename Type, size_t Size>
+struct CPPEXPOSE_TEMPLATE_API has_equal_operator<std::array<Type, Size>> : public has_equal_operator<Type> {};
+
+template <typename Type, typename Allocator>
+struct CPPEXPOSE_TEMPLATE_API has_equal_operator<std::vector<Type, Allocator>> : public has_equal_operator<Type> {};
+
 template <typename Condition, typename Type>
 struct CPPEXPOSE_TEMPLATE_API value_accessor : public std::enable_if<Condition::value, Type> {};
 
@@ -71,6 +119,9 @@ struct CPPEXPOSE_TEMPLATE_API And : public all<Conditions...> {};
 template <typename Type>
 struct CPPEXPOSE_TEMPLATE_API isArray : public is_array<Type> {};
 
+template <typename Type>
+struct CPPEXPOSE_TEMPLATE_API isVector : public is_vector<Type> {};
+
 template <typename Type>
 struct CPPEXPOSE_TEMPLATE_API isBoolArray : public is_special_array<bool, Type> {};
 
@@ -94,10 +145,22 @@ struct CPPEXPOSE_TEMPLATE_API isSignedIntegral : public And<std::is_integral<Typ
                                      std::is_signed<Type>::value, 
                                      Neg<std::is_same<Type, bool>>::value> {};
 
+template <typename Type>
+struct CPPEXPOSE_TEMPLATE_API isCharacter : public std::integral_constant<bool,
+                                std::is_same<Type, char>::value ||
+                                std::is_same<Type, signed char>::value ||
+                                std::is_same<Type, unsigned char>::value> {};
+
 template <typename Type>
 struct CPPEXPOSE_TEMPLATE_API isFloatingPoint : public And<std::is_floating_point<Type>::value,
                                     Neg<std::is_same<Type, long double>>::value> {};
                                     
+template <typename Type>
+struct CPPEXPOSE_TEMPLATE_API isEqualityComparable : public std::integral_constant<bool, has_equal_operator<Type>::value> {};
+
+template <typename Function, typename Result, typename... Arguments>
+struct CPPEXPOSE_TEMPLATE_API isCallable : public std::integral_constant<bool, is_callable<Function, Result, Arguments...>::value> {};
+
 template <typename Type>
 struct CPPEXPOSE_TEMPLATE_API isPlain : public And<Neg<std::is_reference<Type>>::value,
                             Neg<std::is_const<Type>>::value,
@@ -0,0 +1,135 @@
+
+#pragma once
+
+
+#include <cstdint>
+#include <string>
+#include <vector>
+#include <iosfwd>
+
+#include <cppexpose/cppexpose_api.h>
+
+
+namespace cppexpose
+{
+
+
+class Variant;
+
+
+/**
+*  @brief
+*    CBOR tools
+*
+*    Encodes variants in the Concise Binary Object Representation (CBOR, RFC 8949),
+*    a compact binary alternative to JSON. Numbers are stored in their binary
+*    representation, so they are neither formatted nor parsed.
+*
+*    Variant arrays and maps are encoded as CBOR arrays and maps, packed numeric
+*    arrays as typed arrays (RFC 8746), i.e., as a tagged byte string that can be
+*    read and written as a whole. Strings and integers use the shortest encoding,
+*    floating point numbers keep their precision.
+*
+*    When decoding, integers are stored as int if they fit, otherwise as unsigned
+*    int, long long or unsigned long long. Untagged byte strings are decoded as
+*    std::vector<std::uint8_t>. Values that cannot be represented by a variant
+*    (e.g., undefined or unknown simple values) are decoded as empty variants.
+*/
+class CPPEXPOSE_API CBOR
+{
+public:
+    /**
+    *  @brief
+    *    Encode variant into a buffer
+    *
+    *  @param[in] root
+    *    Variant value
+    *
+    *  @return
+    *    CBOR data
+    */
+    static std::vector<std::uint8_t> encode(const Variant & root);
+
+    /**
+    *  @brief
+    *    Encode variant into a stream
+    *
+    *  @param[in] root
+    *    Variant value
+    *  @param[in] stream
+    *    Output stream (should be opened in binary mode)
+    *
+    *  @return
+    *    'true' if all went fine, 'false' on error
+    */
+    static bool encode(const Variant & root, std::ostream & stream);
+
+    /**
+    *  @brief
+    *    Save variant to CBOR file
+    *
+    *  @param[in] root
+    *    Variant value
+    *  @param[in] filename
+    *    Filename of CBOR file
+    *
+    *  @return
+    *    'true' if all went fine, 'false' on error
+    */
+    static bool save(const Variant & root, const std::string & filename);
+
+    //@{
+    /**
+    *  @brief
+    *    Decode variant from a buffer
+    *
+    *  @param[out] root
+    *    Output variant
+    *  @param[in] buffer
+    *    CBOR data
+    *  @param[in] data
+    *    Pointer to CBOR data
+    *  @param[in] size
+    *    Size of CBOR data (in bytes)
+    *
+    *  @return
+    *    'true' if all went fine, 'false' on error
+    */
+    static bool decode(Variant & root, const std::vector<std::uint8_t> & buffer);
+    static bool decode(Variant & root, const std::uint8_t * data, size_t size);
+    //@}
+
+    /**
+    *  @brief
+    *    Decode variant from a stream
+    *
+    *  @param[out] root
+    *    Output variant
+    *  @param[in] stream
+    *    Input stream (should be opened in binary mode)
+    *
+    *  @return
+    *    'true' if all went fine, 'false' on error
+    *
+    *  @remarks
+    *    Exactly one CBOR data item is read from the stream.
+    */
+    static bool decode(Variant & root, std::istream & stream);
+
+    /**
+    *  @brief
+    *    Load variant from CBOR file
+    *
+    *  @param[out] root
+    *    Output variant
+    *  @param[in] filename
+    *    Filename of CBOR file
+    *
+    *  @return
+    *    'true' if all went fine, 'false' on error
+    */
+    static bool load(Variant & root, const std::string & filename);
+};
+
+
+} // namespace cppexpose
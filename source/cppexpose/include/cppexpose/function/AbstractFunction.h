@@ -6,6 +6,7 @@
 #include <memory>
 
 #include <cppexpose/cppexpose_api.h>
+#include <cppexpose/base/FreeListPool.h>
 
 
 namespace cppexpose
@@ -18,7 +19,7 @@ class Variant;
 *  @brief
 *    Base class for callable functions or function objects
 */
-class CPPEXPOSE_API AbstractFunction
+class CPPEXPOSE_API AbstractFunction : public PoolAllocated
 {
 public:
     /**
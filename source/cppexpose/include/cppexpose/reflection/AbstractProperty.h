@@ -4,6 +4,7 @@
 
 #include <string>
 
+#include <cppexpose/base/Symbol.h>
 #include <cppexpose/signal/Signal.h>
 #include <cppexpose/typed/AbstractTyped.h>
 #include <cppexpose/variant/Variant.h>
@@ -25,6 +26,39 @@ class CPPEXPOSE_API AbstractProperty : public AbstractTyped
     friend class Object;
 
 
+public:
+    /**
+    *  @brief
+    *    Behavior of setters when the new value equals the current value
+    */
+    enum class SetMode : unsigned char
+    {
+        Default,   ///< Use the global default (see setDefaultSetMode())
+        Always,    ///< Always set the value and notify the change
+        IfChanged  ///< Skip values that are equal to the current value
+    };
+
+
+public:
+    /**
+    *  @brief
+    *    Get global default set mode
+    *
+    *  @return
+    *    Set mode for properties with SetMode::Default (initially SetMode::Always)
+    */
+    static SetMode defaultSetMode();
+
+    /**
+    *  @brief
+    *    Set global default set mode
+    *
+    *  @param[in] mode
+    *    Set mode for properties with SetMode::Default (SetMode::Default resets it to SetMode::Always)
+    */
+    static void setDefaultSetMode(SetMode mode);
+
+
 public:
     Signal<AbstractProperty *>  beforeDestroy; ///< Called before a property is destroyed
     Signal<const std::string &> optionChanged; ///< Called when an option of the property has been changed
@@ -61,6 +95,15 @@ public:
     */
     const std::string & name() const;
 
+    /**
+    *  @brief
+    *    Get name as symbol
+    *
+    *  @return
+    *    Interned name
+    */
+    const Symbol & nameSymbol() const;
+
     /**
     *  @brief
     *    Set name
@@ -187,6 +230,32 @@ public:
     */
     bool removeOption(const std::string & key);
 
+    /**
+    *  @brief
+    *    Get set mode
+    *
+    *  @return
+    *    Behavior of setters when the new value equals the current value
+    */
+    SetMode setMode() const;
+
+    /**
+    *  @brief
+    *    Set set mode
+    *
+    *  @param[in] mode
+    *    Behavior of setters when the new value equals the current value
+    *
+    *  @remarks
+    *    With SetMode::IfChanged, valueChanged is only emitted if the value
+    *    has actually changed. This costs a comparison (and for stored values
+    *    a call of the getter) on every set.
+    */
+    void setSetMode(SetMode mode);
+
+    // Virtual AbstractTyped interface
+    virtual bool skipsUnchangedValues() const override;
+
 
 protected:
     /**
@@ -235,9 +304,10 @@ protected:
 
 
 protected:
-    std::string   m_name;    ///< Name of the property
+    Symbol        m_name;    ///< Name of the property (interned)
     Object      * m_parent;  ///< Parent object
     VariantMap    m_options; ///< Additional options for the property (e.g., minimum or maximum values)
+    SetMode       m_setMode; ///< Behavior of setters when the new value equals the current value
 };
 
 
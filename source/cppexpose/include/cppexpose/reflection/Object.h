@@ -10,12 +10,16 @@
 #include <cppexpose/typed/AbstractTyped.h>
 #include <cppexpose/reflection/DynamicProperty.h>
 #include <cppexpose/reflection/Method.h>
+#include <cppexpose/reflection/PropertyPath.h>
 
 
 namespace cppexpose
 {
 
 
+class VariantPatch;
+
+
 /**
 *  @brief
 *    Base class for reflection-enabled objects
@@ -38,6 +42,20 @@ public:
     //Signal<size_t, Method *> afterRemove;          ///< Called after a function is removed from the object
 
 
+public:
+    /**
+    *  @brief
+    *    Get structure generation
+    *
+    *  @return
+    *    Counter that is incremented whenever a property is added to or removed from any object
+    *
+    *  @remarks
+    *    This is used to detect when cached property paths (see PropertyPath) may be outdated.
+    */
+    static unsigned long long structureGeneration();
+
+
 public:
     //@{
     /**
@@ -113,8 +131,13 @@ public:
     *
     *  @return
     *    Map of names and properties
+    *
+    *  @remarks
+    *    The names are interned symbols, which convert implicitly to
+    *    const std::string &. To find a property by its name, use
+    *    property() or look up the symbol with Symbol::lookup().
     */
-    const std::unordered_map<std::string, AbstractProperty *> & properties() const;
+    const std::unordered_map<Symbol, AbstractProperty *> & properties() const;
 
     /**
     *  @brief
@@ -159,6 +182,25 @@ public:
     const AbstractProperty * property(const std::string & path) const;
     //@}
 
+    //@{
+    /**
+    *  @brief
+    *    Get property by precompiled path
+    *
+    *  @param[in] path
+    *    Path of property relative to the object
+    *
+    *  @return
+    *    Pointer to the property, or nullptr on error
+    *
+    *  @remarks
+    *    The result is cached in the path until the structure of any object changes,
+    *    so resolving the same path repeatedly does not look up any names.
+    */
+    AbstractProperty * property(const PropertyPath & path);
+    const AbstractProperty * property(const PropertyPath & path) const;
+    //@}
+
     //@{
     /**
     *  @brief
@@ -317,6 +359,7 @@ public:
     virtual std::unique_ptr<AbstractTyped> clone() const override;
     virtual const std::type_info & type() const override;
     virtual std::string typeName() const override;
+    virtual const TypeDescriptor & typeDescriptor() const override;
     virtual bool isReadOnly() const override;
     virtual bool isComposite() const override;
     virtual size_t numSubValues() const override;
@@ -361,17 +404,37 @@ public:
     */
     std::string relativePathTo(const Object * const other) const;
 
+    /**
+    *  @brief
+    *    Apply changes to the values of properties
+    *
+    *  @param[in] patch
+    *    Patch, e.g., computed by VariantPatch::diff() from two versions of the variant representation of the object
+    *
+    *  @return
+    *    'true' if all changes could be applied, 'false' if a change refers to a property that does not exist
+    *
+    *  @remarks
+    *    In contrast to fromVariant(), only the properties that have been changed are
+    *    updated, so valueChanged is not emitted for unchanged properties. If a path leads
+    *    into a property value that is not an object (e.g., a variant map), the value of
+    *    the property is updated as a whole. Properties are not removed from objects, so
+    *    changes that remove a property are ignored.
+    */
+    bool applyPatch(const VariantPatch & patch);
+
 
 protected:
-    const AbstractProperty * findProperty(const std::vector<std::string> & path) const;
+    const AbstractProperty * findProperty(const std::string & path) const;
+    const AbstractProperty * findProperty(const PropertyPath & path) const;
 
 
 protected:
-    std::string                                         m_className;         ///< Class name for this object (default: "Object")
-    std::vector<AbstractProperty *>                     m_properties;        ///< List of properties in the object
-    std::unordered_map<std::string, AbstractProperty *> m_propertiesMap;     ///< Map of names and properties
-    std::vector<std::unique_ptr<AbstractProperty>>      m_managedProperties; ///< Property that are owned by the object
-    std::vector<Method>                                 m_functions;         ///< List of exported functions
+    std::string                                    m_className;         ///< Class name for this object (default: "Object")
+    std::vector<AbstractProperty *>                m_properties;        ///< List of properties in the object
+    std::unordered_map<Symbol, AbstractProperty *> m_propertiesMap;     ///< Map of names and properties
+    std::vector<std::unique_ptr<AbstractProperty>> m_managedProperties; ///< Property that are owned by the object
+    std::vector<Method>                            m_functions;         ///< List of exported functions
 };
 
 
@@ -0,0 +1,110 @@
+
+#pragma once
+
+
+#include <string>
+#include <vector>
+
+#include <cppexpose/cppexpose_api.h>
+#include <cppexpose/base/Symbol.h>
+
+
+namespace cppexpose
+{
+
+
+class Object;
+class AbstractProperty;
+
+
+/**
+*  @brief
+*    Precompiled path to a property
+*
+*    A property path is parsed only once into a list of interned segments,
+*    e.g., "Sub1.Sub2.Property" or "parent.Property". Passing it to
+*    Object::property() therefore neither splits strings nor hashes names.
+*
+*    In addition, the path caches the property it has last been resolved
+*    to. The cache is valid until properties are added to or removed from
+*    any object (see Object::structureGeneration()), so resolving the same
+*    path repeatedly in a stable object tree costs only a comparison.
+*
+*  @remarks
+*    All segments are interned as symbols, so paths should only be created
+*    for names that are used frequently. The cache is not synchronized, so
+*    a path must not be resolved on several threads at the same time.
+*/
+class CPPEXPOSE_API PropertyPath
+{
+    friend class Object;
+
+
+public:
+    /**
+    *  @brief
+    *    Constructor (empty path)
+    */
+    PropertyPath();
+
+    //@{
+    /**
+    *  @brief
+    *    Constructor
+    *
+    *  @param[in] path
+    *    Path of property relative to an object, e.g. "Prop1", or "Sub1.Sub2.Property"
+    *
+    *  @remarks
+    *    Empty segments are ignored, like in Object::property(const std::string &).
+    *    The constructors are explicit, so that strings are not parsed into
+    *    temporary paths by accident.
+    */
+    explicit PropertyPath(const std::string & path);
+    explicit PropertyPath(const char * path);
+    //@}
+
+    /**
+    *  @brief
+    *    Get path string
+    *
+    *  @return
+    *    Path as passed to the constructor
+    */
+    const std::string & str() const;
+
+    /**
+    *  @brief
+    *    Get segments
+    *
+    *  @return
+    *    Names of the properties on the path ("parent" refers to the parent object)
+    */
+    const std::vector<Symbol> & segments() const;
+
+    /**
+    *  @brief
+    *    Check if path is empty
+    *
+    *  @return
+    *    'true' if the path has no segments, else 'false'
+    */
+    bool isEmpty() const;
+
+    /**
+    *  @brief
+    *    Discard the cached property
+    */
+    void invalidate() const;
+
+
+protected:
+    std::string                        m_path;             ///< Path string
+    std::vector<Symbol>                m_segments;         ///< Interned path segments
+    mutable const Object             * m_cachedObject;     ///< Object the path has last been resolved from (can be null)
+    mutable const AbstractProperty   * m_cachedProperty;   ///< Resolved property (can be null)
+    mutable unsigned long long         m_cachedGeneration; ///< Structure generation at the time of the resolution
+};
+
+
+} // namespace cppexpose
@@ -7,6 +7,7 @@
 #include <memory>
 
 #include <cppexpose/typed/TypeInterface.h>
+#include <cppexpose/typed/TypeDescriptor.h>
 
 
 namespace cppexpose
@@ -74,6 +75,19 @@ public:
     */
     virtual std::string typeName() const = 0;
 
+    /**
+    *  @brief
+    *    Get type descriptor
+    *
+    *  @return
+    *    Descriptor of the data type, which is shared by all values of the same type
+    *
+    *  @remarks
+    *    The descriptor provides the name and all type flags (isNumber(), isArray(), etc.)
+    *    at once, so they can be queried without further virtual calls.
+    */
+    virtual const TypeDescriptor & typeDescriptor() const = 0;
+
     /**
     *  @brief
     *    Check if value is const (read-only)
@@ -113,6 +127,20 @@ public:
     */
     virtual AbstractTyped * subValue(size_t i) = 0;
 
+    /**
+    *  @brief
+    *    Check if setting an unchanged value is skipped
+    *
+    *  @return
+    *    'true' if setters compare the new value with the current value and
+    *    ignore it if both are equal, so no change is notified, else 'false'
+    *
+    *  @remarks
+    *    Values of types without operator== are never considered equal.
+    *    By default, this returns 'false'.
+    */
+    virtual bool skipsUnchangedValues() const;
+
     /**
     *  @brief
     *    Check if variant type can be converted
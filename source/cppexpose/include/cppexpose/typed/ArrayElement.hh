@@ -0,0 +1,82 @@
+
+#pragma once
+
+
+#include <cppexpose/cppexpose_api.h>
+#include <cppexpose/base/FreeListPool.h>
+#include <cppexpose/typed/GetTyped.hh>
+
+
+namespace cppexpose
+{
+
+
+/**
+*  @brief
+*    Typed accessor for an element of a typed array
+*
+*    An element accessor only consists of a pointer to the array and the index
+*    of the element, and it reads and writes the element by the array's
+*    getElement() and setElement(). It can therefore be constructed on the stack
+*    and copied without allocating memory. Changes are notified by the array.
+*
+*  @remarks
+*    The accessor must not outlive the array.
+*/
+template <typename ET, typename ARRAY>
+class CPPEXPOSE_TEMPLATE_API ArrayElement : public GetTyped<ET, AbstractTyped>::Type, public PoolAllocated
+{
+public:
+    /**
+    *  @brief
+    *    Constructor
+    *
+    *  @param[in] array
+    *    Typed array (must NOT be null)
+    *  @param[in] index
+    *    Index of the element in the array
+    */
+    ArrayElement(ARRAY * array, size_t index);
+
+    /**
+    *  @brief
+    *    Destructor
+    */
+    virtual ~ArrayElement();
+
+    /**
+    *  @brief
+    *    Get array
+    *
+    *  @return
+    *    Typed array (never null)
+    */
+    ARRAY * array() const;
+
+    /**
+    *  @brief
+    *    Get index
+    *
+    *  @return
+    *    Index of the element in the array
+    */
+    size_t index() const;
+
+    // Virtual AbstractTyped interface
+    virtual std::unique_ptr<AbstractTyped> clone() const override;
+    virtual bool isReadOnly() const override;
+
+    // Virtual Typed<ET> interface
+    virtual ET value() const override;
+    virtual void setValue(const ET & value) override;
+    virtual const ET * ptr() const override;
+    virtual ET * ptr() override;
+
+
+protected:
+    ARRAY * m_array; ///< Typed array (never null)
+    size_t  m_index; ///< Index of the element in the array
+};
+
+
+} // namespace cppexpose
@@ -0,0 +1,77 @@
+
+#pragma once
+
+
+#include <cppassist/memory/make_unique.h>
+
+
+namespace cppexpose
+{
+
+
+template <typename ET, typename ARRAY>
+ArrayElement<ET, ARRAY>::ArrayElement(ARRAY * array, size_t index)
+: m_array(array)
+, m_index(index)
+{
+}
+
+template <typename ET, typename ARRAY>
+ArrayElement<ET, ARRAY>::~ArrayElement()
+{
+}
+
+template <typename ET, typename ARRAY>
+ARRAY * ArrayElement<ET, ARRAY>::array() const
+{
+    return m_array;
+}
+
+template <typename ET, typename ARRAY>
+size_t ArrayElement<ET, ARRAY>::index() const
+{
+    return m_index;
+}
+
+template <typename ET, typename ARRAY>
+std::unique_ptr<AbstractTyped> ArrayElement<ET, ARRAY>::clone() const
+{
+    return std::unique_ptr<AbstractTyped>(cppassist::make_unique<ArrayElement<ET, ARRAY>>(m_array, m_index));
+}
+
+template <typename ET, typename ARRAY>
+bool ArrayElement<ET, ARRAY>::isReadOnly() const
+{
+    return m_array->isReadOnly();
+}
+
+template <typename ET, typename ARRAY>
+ET ArrayElement<ET, ARRAY>::value() const
+{
+    return m_array->getElement(m_index);
+}
+
+template <typename ET, typename ARRAY>
+void ArrayElement<ET, ARRAY>::setValue(const ET & value)
+{
+    m_array->setElement(m_index, value);
+}
+
+template <typename ET, typename ARRAY>
+const ET * ArrayElement<ET, ARRAY>::ptr() const
+{
+    // Elements can be read in place if the array provides direct access
+    const auto * array = static_cast<const ARRAY *>(m_array)->ptr();
+
+    return array ? &(*array)[m_index] : nullptr;
+}
+
+template <typename ET, typename ARRAY>
+ET * ArrayElement<ET, ARRAY>::ptr()
+{
+    // Writing in place would bypass the change notification of the array
+    return nullptr;
+}
+
+
+} // namespace cppexpose
@@ -5,6 +5,7 @@
 #include <cppexpose/cppexpose_api.h>
 #include <cppexpose/typed/DirectValueSingle.hh>
 #include <cppexpose/typed/DirectValueArray.hh>
+#include <cppexpose/typed/DirectValueVector.hh>
 
 
 namespace cppexpose
@@ -23,6 +24,12 @@ struct CPPEXPOSE_TEMPLATE_API DirectValueType<T, BASE, helper::EnableIf<helper::
     using Type = DirectValueArray<T, BASE>;
 };
 
+template <typename T, typename BASE>
+struct CPPEXPOSE_TEMPLATE_API DirectValueType<T, BASE, helper::EnableIf<helper::isVector<T>>>
+{
+    using Type = DirectValueVector<T, BASE>;
+};
+
 
 /**
 *  @brief
@@ -51,6 +58,15 @@ public:
     */
     DirectValue(const T & value);
 
+    /**
+    *  @brief
+    *    Constructor
+    *
+    *  @param[in] value
+    *    Initial value (is moved into the typed value)
+    */
+    DirectValue(T && value);
+
     /**
     *  @brief
     *    Destructor
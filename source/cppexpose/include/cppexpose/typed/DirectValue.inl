@@ -2,6 +2,9 @@
 #pragma once
 
 
+#include <utility>
+
+
 namespace cppexpose
 {
 
@@ -18,6 +21,12 @@ DirectValue<T, BASE>::DirectValue(const T & value)
 {
 }
 
+template <typename T, typename BASE>
+DirectValue<T, BASE>::DirectValue(T && value)
+: BaseType(std::move(value))
+{
+}
+
 template <typename T, typename BASE>
 DirectValue<T, BASE>::~DirectValue()
 {
@@ -3,6 +3,7 @@
 
 
 #include <cppexpose/cppexpose_api.h>
+#include <cppexpose/base/FreeListPool.h>
 #include <cppexpose/typed/GetTyped.hh>
 
 
@@ -15,7 +16,7 @@ namespace cppexpose
 *    Typed array value (read/write) that is stored directly
 */
 template <typename T, typename BASE>
-class CPPEXPOSE_TEMPLATE_API DirectValueArray : public GetTyped<T, BASE>::Type
+class CPPEXPOSE_TEMPLATE_API DirectValueArray : public GetTyped<T, BASE>::Type, public PoolAllocated
 {
 public:
     typedef typename GetTyped<T, BASE>::Type::ElementType ElementType;
@@ -37,6 +38,15 @@ public:
     */
     DirectValueArray(const T & value);
 
+    /**
+    *  @brief
+    *    Constructor
+    *
+    *  @param[in] value
+    *    Initial value (is moved into the typed value)
+    */
+    DirectValueArray(T && value);
+
     /**
     *  @brief
     *    Destructor
@@ -55,6 +65,8 @@ public:
     // Virtual TypedArray<T> interface
     virtual ElementType getElement(size_t i) const override;
     virtual void setElement(size_t i, const ElementType & value) override;
+    virtual size_t getElements(size_t first, size_t count, ElementType * elements) const override;
+    virtual size_t setElements(size_t first, size_t count, const ElementType * elements) override;
 
 
 protected:
@@ -85,6 +97,15 @@ public:
     */
     DirectValueArray(const T & value);
 
+    /**
+    *  @brief
+    *    Constructor
+    *
+    *  @param[in] value
+    *    Initial value (is moved into the typed value)
+    */
+    DirectValueArray(T && value);
+
     /**
     *  @brief
     *    Destructor
@@ -101,6 +122,7 @@ public:
 
     // Virtual TypedArray<T> interface
     virtual void setElement(size_t i, const typename DirectValueArray<T, BASE>::ElementType & value) override;
+    virtual size_t setElements(size_t first, size_t count, const typename DirectValueArray<T, BASE>::ElementType * elements) override;
 };
 
 
@@ -2,6 +2,9 @@
 #pragma once
 
 
+#include <utility>
+
+
 namespace cppexpose
 {
 
@@ -18,6 +21,12 @@ DirectValueArray<T, BASE>::DirectValueArray(const T & value)
 {
 }
 
+template <typename T, typename BASE>
+DirectValueArray<T, BASE>::DirectValueArray(T && value)
+: m_value(std::move(value))
+{
+}
+
 template <typename T, typename BASE>
 DirectValueArray<T, BASE>::~DirectValueArray()
 {
@@ -38,6 +47,10 @@ T DirectValueArray<T, BASE>::value() const
 template <typename T, typename BASE>
 void DirectValueArray<T, BASE>::setValue(const T & value)
 {
+    if (this->skipsUnchangedValues() && this->isEqual(m_value, value)) {
+        return;
+    }
+
     m_value = value;
     this->onValueChanged(m_value);
 }
@@ -63,10 +76,46 @@ typename DirectValueArray<T, BASE>::ElementType DirectValueArray<T, BASE>::getEl
 template <typename T, typename BASE>
 void DirectValueArray<T, BASE>::setElement(size_t i, const typename DirectValueArray<T, BASE>::ElementType & value)
 {
+    if (this->skipsUnchangedValues() && this->isEqual(m_value[i], value)) {
+        return;
+    }
+
     m_value[i] = value;
     this->onValueChanged(m_value);
 }
 
+template <typename T, typename BASE>
+size_t DirectValueArray<T, BASE>::getElements(size_t first, size_t count, typename DirectValueArray<T, BASE>::ElementType * elements) const
+{
+    count = this->clipRange(first, count);
+
+    for (size_t i=0; i<count; i++) {
+        elements[i] = m_value[first + i];
+    }
+
+    return count;
+}
+
+template <typename T, typename BASE>
+size_t DirectValueArray<T, BASE>::setElements(size_t first, size_t count, const typename DirectValueArray<T, BASE>::ElementType * elements)
+{
+    count = this->clipRange(first, count);
+
+    if (this->skipsUnchangedValues() && this->isEqualRange(&m_value[first], elements, count)) {
+        return count;
+    }
+
+    for (size_t i=0; i<count; i++) {
+        m_value[first + i] = elements[i];
+    }
+
+    if (count > 0) {
+        this->onValueChanged(m_value);
+    }
+
+    return count;
+}
+
 
 // Read-only type
 template <typename T, typename BASE>
@@ -80,6 +129,12 @@ DirectValueArray<const T, BASE>::DirectValueArray(const T & value)
 {
 }
 
+template <typename T, typename BASE>
+DirectValueArray<const T, BASE>::DirectValueArray(T && value)
+: DirectValueArray<T, BASE>::DirectValueArray(std::move(value))
+{
+}
+
 template <typename T, typename BASE>
 DirectValueArray<const T, BASE>::~DirectValueArray()
 {
@@ -117,5 +172,12 @@ void DirectValueArray<const T, BASE>::setElement(size_t, const typename DirectVa
     // Read-only!
 }
 
+template <typename T, typename BASE>
+size_t DirectValueArray<const T, BASE>::setElements(size_t, size_t, const typename DirectValueArray<T, BASE>::ElementType *)
+{
+    // Read-only!
+    return 0;
+}
+
 
 } // namespace cppexpose
@@ -3,6 +3,7 @@
 
 
 #include <cppexpose/cppexpose_api.h>
+#include <cppexpose/base/FreeListPool.h>
 #include <cppexpose/typed/GetTyped.hh>
 
 
@@ -15,7 +16,7 @@ namespace cppexpose
 *    Typed value (read/write) that is stored directly
 */
 template <typename T, typename BASE>
-class CPPEXPOSE_TEMPLATE_API DirectValueSingle : public GetTyped<T, BASE>::Type
+class CPPEXPOSE_TEMPLATE_API DirectValueSingle : public GetTyped<T, BASE>::Type, public PoolAllocated
 {
 public:
     /**
@@ -33,6 +34,15 @@ public:
     */
     DirectValueSingle(const T & value);
 
+    /**
+    *  @brief
+    *    Constructor
+    *
+    *  @param[in] value
+    *    Initial value (is moved into the typed value)
+    */
+    DirectValueSingle(T && value);
+
     /**
     *  @brief
     *    Destructor
@@ -77,6 +87,15 @@ public:
     */
     DirectValueSingle(const T & value);
 
+    /**
+    *  @brief
+    *    Constructor
+    *
+    *  @param[in] value
+    *    Initial value (is moved into the typed value)
+    */
+    DirectValueSingle(T && value);
+
     /**
     *  @brief
     *    Destructor
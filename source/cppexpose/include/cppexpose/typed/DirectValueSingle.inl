@@ -2,6 +2,8 @@
 #pragma once
 
 
+#include <utility>
+
 #include <cppassist/memory/make_unique.h>
 
 
@@ -21,6 +23,12 @@ DirectValueSingle<T, BASE>::DirectValueSingle(const T & value)
 {
 }
 
+template <typename T, typename BASE>
+DirectValueSingle<T, BASE>::DirectValueSingle(T && value)
+: m_value(std::move(value))
+{
+}
+
 template <typename T, typename BASE>
 DirectValueSingle<T, BASE>::~DirectValueSingle()
 {
@@ -41,6 +49,10 @@ T DirectValueSingle<T, BASE>::value() const
 template <typename T, typename BASE>
 void DirectValueSingle<T, BASE>::setValue(const T & value)
 {
+    if (this->skipsUnchangedValues() && this->isEqual(m_value, value)) {
+        return;
+    }
+
     m_value = value;
     this->onValueChanged(m_value);
 }
@@ -70,6 +82,12 @@ DirectValueSingle<const T, BASE>::DirectValueSingle(const T & value)
 {
 }
 
+template <typename T, typename BASE>
+DirectValueSingle<const T, BASE>::DirectValueSingle(T && value)
+: DirectValueSingle<T, BASE>::DirectValueSingle(std::move(value))
+{
+}
+
 template <typename T, typename BASE>
 DirectValueSingle<const T, BASE>::~DirectValueSingle()
 {
@@ -0,0 +1,5 @@
+
+#pragma once
+
+
+#include <cppexpose/typed/typed_includes.inl>
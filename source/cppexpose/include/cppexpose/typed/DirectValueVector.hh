@@ -0,0 +1,134 @@
+
+#pragma once
+
+
+#include <cppexpose/cppexpose_api.h>
+#include <cppexpose/base/FreeListPool.h>
+#include <cppexpose/typed/GetTyped.hh>
+
+
+namespace cppexpose
+{
+
+
+/**
+*  @brief
+*    Typed vector value (read/write) that is stored directly
+*
+*    Element access and resizing work in place, without copying the vector.
+*/
+template <typename T, typename BASE>
+class CPPEXPOSE_TEMPLATE_API DirectValueVector : public GetTyped<T, BASE>::Type, public PoolAllocated
+{
+public:
+    typedef typename GetTyped<T, BASE>::Type::ElementType ElementType;
+
+
+public:
+    /**
+    *  @brief
+    *    Constructor
+    */
+    DirectValueVector();
+
+    /**
+    *  @brief
+    *    Constructor
+    *
+    *  @param[in] value
+    *    Initial value
+    */
+    DirectValueVector(const T & value);
+
+    /**
+    *  @brief
+    *    Constructor
+    *
+    *  @param[in] value
+    *    Initial value (is moved into the typed value)
+    */
+    DirectValueVector(T && value);
+
+    /**
+    *  @brief
+    *    Destructor
+    */
+    virtual ~DirectValueVector();
+
+    // Virtual AbstractTyped interface
+    virtual std::unique_ptr<AbstractTyped> clone() const override;
+
+    // Virtual Typed<T> interface
+    virtual T value() const override;
+    virtual void setValue(const T & value) override;
+    virtual const T * ptr() const override;
+    virtual T * ptr() override;
+
+    // Virtual TypedVector<T> interface
+    virtual size_t numElements() const override;
+    virtual void resize(size_t size) override;
+    virtual ElementType getElement(size_t i) const override;
+    virtual void setElement(size_t i, const ElementType & value) override;
+    virtual size_t getElements(size_t first, size_t count, ElementType * elements) const override;
+    virtual size_t setElements(size_t first, size_t count, const ElementType * elements) override;
+
+
+protected:
+    T m_value;  ///< The stored value
+};
+
+
+/**
+*  @brief
+*    Typed vector value (read-only) that is stored directly
+*/
+template <typename T, typename BASE>
+class CPPEXPOSE_TEMPLATE_API DirectValueVector<const T, BASE> : public DirectValueVector<T, BASE>
+{
+public:
+    /**
+    *  @brief
+    *    Constructor
+    */
+    DirectValueVector();
+
+    /**
+    *  @brief
+    *    Constructor
+    *
+    *  @param[in] value
+    *    Initial value
+    */
+    DirectValueVector(const T & value);
+
+    /**
+    *  @brief
+    *    Constructor
+    *
+    *  @param[in] value
+    *    Initial value (is moved into the typed value)
+    */
+    DirectValueVector(T && value);
+
+    /**
+    *  @brief
+    *    Destructor
+    */
+    virtual ~DirectValueVector();
+
+    // Virtual AbstractTyped interface
+    virtual std::unique_ptr<AbstractTyped> clone() const override;
+    virtual bool isReadOnly() const override;
+
+    // Virtual Typed<T> interface
+    virtual void setValue(const T & value) override;
+    virtual T * ptr() override;
+
+    // Virtual TypedVector<T> interface
+    virtual void resize(size_t size) override;
+    virtual void setElement(size_t i, const typename DirectValueVector<T, BASE>::ElementType & value) override;
+    virtual size_t setElements(size_t first, size_t count, const typename DirectValueVector<T, BASE>::ElementType * elements) override;
+};
+
+
+} // namespace cppexpose
@@ -0,0 +1,217 @@
+
+#pragma once
+
+
+#include <utility>
+
+
+namespace cppexpose
+{
+
+
+// Read/write type
+template <typename T, typename BASE>
+DirectValueVector<T, BASE>::DirectValueVector()
+{
+}
+
+template <typename T, typename BASE>
+DirectValueVector<T, BASE>::DirectValueVector(const T & value)
+: m_value(value)
+{
+}
+
+template <typename T, typename BASE>
+DirectValueVector<T, BASE>::DirectValueVector(T && value)
+: m_value(std::move(value))
+{
+}
+
+template <typename T, typename BASE>
+DirectValueVector<T, BASE>::~DirectValueVector()
+{
+}
+
+template <typename T, typename BASE>
+std::unique_ptr<AbstractTyped> DirectValueVector<T, BASE>::clone() const
+{
+    return cppassist::make_unique<DirectValueVector<T, AbstractTyped>>(m_value);
+}
+
+template <typename T, typename BASE>
+T DirectValueVector<T, BASE>::value() const
+{
+    return m_value;
+}
+
+template <typename T, typename BASE>
+void DirectValueVector<T, BASE>::setValue(const T & value)
+{
+    if (this->skipsUnchangedValues() && this->isEqual(m_value, value)) {
+        return;
+    }
+
+    m_value = value;
+    this->onValueChanged(m_value);
+}
+
+template <typename T, typename BASE>
+const T * DirectValueVector<T, BASE>::ptr() const
+{
+    return &m_value;
+}
+
+template <typename T, typename BASE>
+T * DirectValueVector<T, BASE>::ptr()
+{
+    return &m_value;
+}
+
+template <typename T, typename BASE>
+size_t DirectValueVector<T, BASE>::numElements() const
+{
+    return m_value.size();
+}
+
+template <typename T, typename BASE>
+void DirectValueVector<T, BASE>::resize(size_t size)
+{
+    m_value.resize(size);
+    this->onValueChanged(m_value);
+}
+
+template <typename T, typename BASE>
+typename DirectValueVector<T, BASE>::ElementType DirectValueVector<T, BASE>::getElement(size_t i) const
+{
+    return (i < m_value.size()) ? m_value[i] : ElementType();
+}
+
+template <typename T, typename BASE>
+void DirectValueVector<T, BASE>::setElement(size_t i, const typename DirectValueVector<T, BASE>::ElementType & value)
+{
+    if (i >= m_value.size()) {
+        return;
+    }
+
+    // Bind to a const reference, as std::vector<bool> returns proxy objects
+    const ElementType & current = m_value[i];
+
+    if (this->skipsUnchangedValues() && this->isEqual(current, value)) {
+        return;
+    }
+
+    m_value[i] = value;
+    this->onValueChanged(m_value);
+}
+
+template <typename T, typename BASE>
+size_t DirectValueVector<T, BASE>::getElements(size_t first, size_t count, typename DirectValueVector<T, BASE>::ElementType * elements) const
+{
+    count = this->clipRange(m_value.size(), first, count);
+
+    for (size_t i=0; i<count; i++) {
+        elements[i] = m_value[first + i];
+    }
+
+    return count;
+}
+
+template <typename T, typename BASE>
+size_t DirectValueVector<T, BASE>::setElements(size_t first, size_t count, const typename DirectValueVector<T, BASE>::ElementType * elements)
+{
+    count = this->clipRange(m_value.size(), first, count);
+
+    if (this->skipsUnchangedValues())
+    {
+        size_t i = 0;
+        while (i < count && this->isEqual(static_cast<const ElementType &>(m_value[first + i]), elements[i])) {
+            i++;
+        }
+
+        if (i == count) {
+            return count;
+        }
+    }
+
+    for (size_t i=0; i<count; i++) {
+        m_value[first + i] = elements[i];
+    }
+
+    if (count > 0) {
+        this->onValueChanged(m_value);
+    }
+
+    return count;
+}
+
+
+// Read-only type
+template <typename T, typename BASE>
+DirectValueVector<const T, BASE>::DirectValueVector()
+{
+}
+
+template <typename T, typename BASE>
+DirectValueVector<const T, BASE>::DirectValueVector(const T & value)
+: DirectValueVector<T, BASE>::DirectValueVector(value)
+{
+}
+
+template <typename T, typename BASE>
+DirectValueVector<const T, BASE>::DirectValueVector(T && value)
+: DirectValueVector<T, BASE>::DirectValueVector(std::move(value))
+{
+}
+
+template <typename T, typename BASE>
+DirectValueVector<const T, BASE>::~DirectValueVector()
+{
+}
+
+template <typename T, typename BASE>
+std::unique_ptr<AbstractTyped> DirectValueVector<const T, BASE>::clone() const
+{
+    return cppassist::make_unique<DirectValueVector<const T, AbstractTyped>>(this->m_value);
+}
+
+template <typename T, typename BASE>
+bool DirectValueVector<const T, BASE>::isReadOnly() const
+{
+    // Read-only!
+    return true;
+}
+
+template <typename T, typename BASE>
+void DirectValueVector<const T, BASE>::setValue(const T &)
+{
+    // Read-only!
+}
+
+template <typename T, typename BASE>
+T * DirectValueVector<const T, BASE>::ptr()
+{
+    // Read-only!
+    return nullptr;
+}
+
+template <typename T, typename BASE>
+void DirectValueVector<const T, BASE>::resize(size_t)
+{
+    // Read-only!
+}
+
+template <typename T, typename BASE>
+void DirectValueVector<const T, BASE>::setElement(size_t, const typename DirectValueVector<T, BASE>::ElementType &)
+{
+    // Read-only!
+}
+
+template <typename T, typename BASE>
+size_t DirectValueVector<const T, BASE>::setElements(size_t, size_t, const typename DirectValueVector<T, BASE>::ElementType *)
+{
+    // Read-only!
+    return 0;
+}
+
+
+} // namespace cppexpose
@@ -14,6 +14,7 @@
 #include <cppexpose/typed/TypedFloatingPoint.hh>
 #include <cppexpose/typed/TypedEnum.hh>
 #include <cppexpose/typed/TypedArray.hh>
+#include <cppexpose/typed/TypedVector.hh>
 #include <cppexpose/typed/TypedVariant.hh>
 #include <cppexpose/typed/TypedFilePath.hh>
 
@@ -125,6 +126,16 @@ struct CPPEXPOSE_TEMPLATE_API GetTyped<T, BASE, helper::EnableIf<helper::isArray
     using Type = TypedArray<T, typename T::value_type, std::tuple_size<T>::value, BASE>;
 };
 
+/**
+*  @brief
+*    Type selector for vector types (except VariantArray)
+*/
+template <typename T, typename BASE>
+struct CPPEXPOSE_TEMPLATE_API GetTyped<T, BASE, helper::EnableIf<helper::isVector<T>>>
+{
+    using Type = TypedVector<T, typename T::value_type, BASE>;
+};
+
 /**
 *  @brief
 *    Type selector for cppexpose::Variant
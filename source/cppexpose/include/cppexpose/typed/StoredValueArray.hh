@@ -3,6 +3,8 @@
 
 
 #include <cppexpose/cppexpose_api.h>
+#include <cppexpose/base/Delegate.h>
+#include <cppexpose/base/FreeListPool.h>
 #include <cppexpose/typed/GetTyped.hh>
 
 
@@ -18,6 +20,7 @@ template<typename T, typename ElementType, typename Obj>
 struct CPPEXPOSE_TEMPLATE_API ArrayValueFunctions
 {
     typedef T (Obj::*getter) () const;
+    typedef const T & (Obj::*refGetter) () const;
     typedef void (Obj::*setter) (const T &);
     typedef ElementType (Obj::*elementGetter) (int) const;
     typedef void (Obj::*elementSetter) (int, const ElementType &);
@@ -29,8 +32,12 @@ struct CPPEXPOSE_TEMPLATE_API ArrayValueFunctions
 *    Typed array value (read/write) that is accessed via getter and setter functions
 */
 template <typename T, typename BASE>
-class CPPEXPOSE_TEMPLATE_API StoredValueArray : public GetTyped<T, BASE>::Type
+class CPPEXPOSE_TEMPLATE_API StoredValueArray : public GetTyped<T, BASE>::Type, public PoolAllocated
 {
+    template <typename, typename>
+    friend class StoredValueArray;
+
+
 public:
     typedef typename GetTyped<T, BASE>::Type::ElementType ElementType;
 
@@ -50,10 +57,10 @@ public:
     *    Function to set an array element
     */
     StoredValueArray(
-        std::function<T ()> getter
-      , std::function<void(const T &)> setter
-      , std::function<ElementType (int)> elementGetter
-      , std::function<void(int, const ElementType &)> elementSetter
+        Delegate<T ()> getter
+      , Delegate<void(const T &)> setter
+      , Delegate<ElementType (int)> elementGetter
+      , Delegate<void(int, const ElementType &)> elementSetter
     );
 
     /**
@@ -78,6 +85,32 @@ public:
                      typename ArrayValueFunctions<T, ElementType, Obj>::elementGetter elementGetter,
                      typename ArrayValueFunctions<T, ElementType, Obj>::elementSetter elementSetter);
 
+    /**
+    *  @brief
+    *    Constructor
+    *
+    *  @param[in] obj
+    *    Object pointer
+    *  @param[in] getter
+    *    Member function that returns a reference to the value
+    *  @param[in] setter
+    *    Member function to set the value
+    *  @param[in] elementGetter
+    *    Member function to get an array element
+    *  @param[in] elementSetter
+    *    Member function to set an array element
+    *
+    *  @remarks
+    *    The value is read directly through the returned reference,
+    *    so it is not copied and ptr() const points to it.
+    */
+    template <typename Obj>
+    StoredValueArray(Obj * obj,
+                     typename ArrayValueFunctions<T, ElementType, Obj>::refGetter getter,
+                     typename ArrayValueFunctions<T, ElementType, Obj>::setter setter,
+                     typename ArrayValueFunctions<T, ElementType, Obj>::elementGetter elementGetter,
+                     typename ArrayValueFunctions<T, ElementType, Obj>::elementSetter elementSetter);
+
     /**
     *  @brief
     *    Destructor
@@ -96,6 +129,8 @@ public:
     // Virtual TypedArray<T> interface
     virtual ElementType getElement(size_t i) const override;
     virtual void setElement(size_t i, const ElementType & value) override;
+    virtual size_t getElements(size_t first, size_t count, ElementType * elements) const override;
+    virtual size_t setElements(size_t first, size_t count, const ElementType * elements) override;
 
 
 protected:
@@ -115,16 +150,17 @@ protected:
     *    Function to get an array element
     */
     StoredValueArray(
-        std::function<T ()> getter
-      , std::function<ElementType (int)> elementGetter
+        Delegate<T ()> getter
+      , Delegate<ElementType (int)> elementGetter
     );
 
 
 protected:
-    std::function<T ()>                           m_getter;        ///< Function to get the value
-    std::function<void(const T &)>                m_setter;        ///< Function to set the value
-    std::function<ElementType (int)>              m_elementGetter; ///< Function to get an array element
-    std::function<void(int, const ElementType &)> m_elementSetter; ///< Function to set an array element
+    Delegate<T ()>                           m_getter;        ///< Function to get the value
+    Delegate<const T * ()>                   m_refGetter;     ///< Function to get a pointer to the value (empty if the value is not accessible by reference)
+    Delegate<void(const T &)>                m_setter;        ///< Function to set the value
+    Delegate<ElementType (int)>              m_elementGetter; ///< Function to get an array element
+    Delegate<void(int, const ElementType &)> m_elementSetter; ///< Function to set an array element
 };
 
 
@@ -146,8 +182,8 @@ public:
     *    Function to get an array element
     */
     StoredValueArray(
-        std::function<T ()> getter
-      , std::function<typename StoredValueArray<T, BASE>::ElementType (int)> elementGetter
+        Delegate<T ()> getter
+      , Delegate<typename StoredValueArray<T, BASE>::ElementType (int)> elementGetter
     );
 
     /**
@@ -166,6 +202,22 @@ public:
                      typename ArrayValueFunctions<T, typename StoredValueArray<T, BASE>::ElementType, Obj>::getter getter,
                      typename ArrayValueFunctions<T, typename StoredValueArray<T, BASE>::ElementType, Obj>::elementGetter elementGetter);
 
+    /**
+    *  @brief
+    *    Constructor
+    *
+    *  @param[in] obj
+    *    Object pointer
+    *  @param[in] getter
+    *    Member function that returns a reference to the value
+    *  @param[in] elementGetter
+    *    Member function to get an array element
+    */
+    template <typename Obj>
+    StoredValueArray(Obj * obj,
+                     typename ArrayValueFunctions<T, typename StoredValueArray<T, BASE>::ElementType, Obj>::refGetter getter,
+                     typename ArrayValueFunctions<T, typename StoredValueArray<T, BASE>::ElementType, Obj>::elementGetter elementGetter);
+
     /**
     *  @brief
     *    Destructor
@@ -181,6 +233,7 @@ public:
 
     // Virtual TypedArray<T> interface
     virtual void setElement(size_t i, const typename StoredValueArray<T, BASE>::ElementType & value) override;
+    virtual size_t setElements(size_t first, size_t count, const typename StoredValueArray<T, BASE>::ElementType * elements) override;
 };
 
 
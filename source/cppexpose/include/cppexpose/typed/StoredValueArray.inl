@@ -9,14 +9,14 @@ namespace cppexpose
 // Read/write type
 template <typename T, typename BASE>
 StoredValueArray<T, BASE>::StoredValueArray(
-    std::function<T ()> getter
-  , std::function<void(const T &)> setter
-  , std::function<ElementType (int)> elementGetter
-  , std::function<void(int, const ElementType &)> elementSetter)
-: m_getter(getter)
-, m_setter(setter)
-, m_elementGetter(elementGetter)
-, m_elementSetter(elementSetter)
+    Delegate<T ()> getter
+  , Delegate<void(const T &)> setter
+  , Delegate<ElementType (int)> elementGetter
+  , Delegate<void(int, const ElementType &)> elementSetter)
+: m_getter(std::move(getter))
+, m_setter(std::move(setter))
+, m_elementGetter(std::move(elementGetter))
+, m_elementSetter(std::move(elementSetter))
 {
 }
 
@@ -55,6 +55,46 @@ StoredValueArray<T, BASE>::StoredValueArray(
     };
 }
 
+template <typename T, typename BASE>
+template <typename Obj>
+StoredValueArray<T, BASE>::StoredValueArray(
+    Obj * obj,
+    typename ArrayValueFunctions<T, ElementType, Obj>::refGetter g,
+    typename ArrayValueFunctions<T, ElementType, Obj>::setter s,
+    typename ArrayValueFunctions<T, ElementType, Obj>::elementGetter eg,
+    typename ArrayValueFunctions<T, ElementType, Obj>::elementSetter es)
+{
+    typename ArrayValueFunctions<T, ElementType, Obj>::refGetter getter = g;
+    typename ArrayValueFunctions<T, ElementType, Obj>::setter setter = s;
+    typename ArrayValueFunctions<T, ElementType, Obj>::elementGetter elementGetter = eg;
+    typename ArrayValueFunctions<T, ElementType, Obj>::elementSetter elementSetter = es;
+
+    m_getter = [obj, getter] () -> T
+    {
+        return (obj->*getter)();
+    };
+
+    m_refGetter = [obj, getter] () -> const T *
+    {
+        return &(obj->*getter)();
+    };
+
+    m_setter = [obj, setter] (const T & value)
+    {
+        (obj->*setter)(value);
+    };
+
+    m_elementGetter = [obj, elementGetter] (int index) -> ElementType
+    {
+        return (obj->*elementGetter)(index);
+    };
+
+    m_elementSetter = [obj, elementSetter] (int index, const ElementType & value)
+    {
+        (obj->*elementSetter)(index, value);
+    };
+}
+
 template <typename T, typename BASE>
 StoredValueArray<T, BASE>::~StoredValueArray()
 {
@@ -63,18 +103,29 @@ StoredValueArray<T, BASE>::~StoredValueArray()
 template <typename T, typename BASE>
 std::unique_ptr<AbstractTyped> StoredValueArray<T, BASE>::clone() const
 {
-    return cppassist::make_unique<StoredValueArray<T, AbstractTyped>>(m_getter, m_setter, m_elementGetter, m_elementSetter);
+    auto value = cppassist::make_unique<StoredValueArray<T, AbstractTyped>>(m_getter, m_setter, m_elementGetter, m_elementSetter);
+    value->m_refGetter = m_refGetter;
+
+    return std::unique_ptr<AbstractTyped>(std::move(value));
 }
 
 template <typename T, typename BASE>
 T StoredValueArray<T, BASE>::value() const
 {
+    if (m_refGetter) {
+        return *m_refGetter();
+    }
+
     return m_getter();
 }
 
 template <typename T, typename BASE>
 void StoredValueArray<T, BASE>::setValue(const T & value)
 {
+    if (this->skipsUnchangedValues() && (m_refGetter ? this->isEqual(*m_refGetter(), value) : this->isEqual(m_getter(), value))) {
+        return;
+    }
+
     m_setter(value);
     this->onValueChanged(value);
 }
@@ -82,7 +133,7 @@ void StoredValueArray<T, BASE>::setValue(const T & value)
 template <typename T, typename BASE>
 const T * StoredValueArray<T, BASE>::ptr() const
 {
-    return nullptr;
+    return m_refGetter ? m_refGetter() : nullptr;
 }
 
 template <typename T, typename BASE>
@@ -100,10 +151,55 @@ typename StoredValueArray<T, BASE>::ElementType StoredValueArray<T, BASE>::getEl
 template <typename T, typename BASE>
 void StoredValueArray<T, BASE>::setElement(size_t i, const typename StoredValueArray<T, BASE>::ElementType & value)
 {
+    if (this->skipsUnchangedValues() && this->isEqual(m_elementGetter(static_cast<int>(i)), value)) {
+        return;
+    }
+
     m_elementSetter(i, value);
     this->onValueChanged(this->value());
 }
 
+template <typename T, typename BASE>
+size_t StoredValueArray<T, BASE>::getElements(size_t first, size_t count, typename StoredValueArray<T, BASE>::ElementType * elements) const
+{
+    count = this->clipRange(first, count);
+
+    for (size_t i=0; i<count; i++) {
+        elements[i] = m_elementGetter(static_cast<int>(first + i));
+    }
+
+    return count;
+}
+
+template <typename T, typename BASE>
+size_t StoredValueArray<T, BASE>::setElements(size_t first, size_t count, const typename StoredValueArray<T, BASE>::ElementType * elements)
+{
+    count = this->clipRange(first, count);
+
+    if (this->skipsUnchangedValues())
+    {
+        size_t i = 0;
+        while (i < count && this->isEqual(m_elementGetter(static_cast<int>(first + i)), elements[i])) {
+            i++;
+        }
+
+        if (i == count) {
+            return count;
+        }
+    }
+
+    for (size_t i=0; i<count; i++) {
+        m_elementSetter(static_cast<int>(first + i), elements[i]);
+    }
+
+    // Fetch the new value only once for all elements
+    if (count > 0) {
+        this->onValueChanged(this->value());
+    }
+
+    return count;
+}
+
 template <typename T, typename BASE>
 StoredValueArray<T, BASE>::StoredValueArray()
 {
@@ -111,10 +207,10 @@ StoredValueArray<T, BASE>::StoredValueArray()
 
 template <typename T, typename BASE>
 StoredValueArray<T, BASE>::StoredValueArray(
-    std::function<T ()> getter
-  , std::function<ElementType (int)> elementGetter)
-: m_getter(getter)
-, m_elementGetter(elementGetter)
+    Delegate<T ()> getter
+  , Delegate<ElementType (int)> elementGetter)
+: m_getter(std::move(getter))
+, m_elementGetter(std::move(elementGetter))
 {
 }
 
@@ -122,9 +218,9 @@ StoredValueArray<T, BASE>::StoredValueArray(
 // Read-only type
 template <typename T, typename BASE>
 StoredValueArray<const T, BASE>::StoredValueArray(
-    std::function<T ()> getter
-  , std::function<typename StoredValueArray<T, BASE>::ElementType (int)> elementGetter)
-: StoredValueArray<T, BASE>::StoredValueArray(getter, elementGetter)
+    Delegate<T ()> getter
+  , Delegate<typename StoredValueArray<T, BASE>::ElementType (int)> elementGetter)
+: StoredValueArray<T, BASE>::StoredValueArray(std::move(getter), std::move(elementGetter))
 {
 }
 
@@ -149,6 +245,32 @@ StoredValueArray<const T, BASE>::StoredValueArray(
     };
 }
 
+template <typename T, typename BASE>
+template <typename Obj>
+StoredValueArray<const T, BASE>::StoredValueArray(
+    Obj * obj,
+    typename ArrayValueFunctions<T, typename StoredValueArray<T, BASE>::ElementType, Obj>::refGetter g,
+    typename ArrayValueFunctions<T, typename StoredValueArray<T, BASE>::ElementType, Obj>::elementGetter eg)
+{
+    typename ArrayValueFunctions<T, typename StoredValueArray<T, BASE>::ElementType, Obj>::refGetter getter = g;
+    typename ArrayValueFunctions<T, typename StoredValueArray<T, BASE>::ElementType, Obj>::elementGetter elementGetter = eg;
+
+    this->m_getter = [obj, getter] () -> T
+    {
+        return (obj->*getter)();
+    };
+
+    this->m_refGetter = [obj, getter] () -> const T *
+    {
+        return &(obj->*getter)();
+    };
+
+    this->m_elementGetter = [obj, elementGetter] (int index) -> typename StoredValueArray<T, BASE>::ElementType
+    {
+        return (obj->*elementGetter)(index);
+    };
+}
+
 template <typename T, typename BASE>
 StoredValueArray<const T, BASE>::~StoredValueArray()
 {
@@ -157,12 +279,10 @@ StoredValueArray<const T, BASE>::~StoredValueArray()
 template <typename T, typename BASE>
 std::unique_ptr<AbstractTyped> StoredValueArray<const T, BASE>::clone() const
 {
-    return cppassist::make_unique<StoredValueArray<const T, AbstractTyped>>(
-      this->m_getter,
-      this->m_setter,
-      this->m_elementGetter,
-      this->m_elementSetter
-    );
+    auto value = cppassist::make_unique<StoredValueArray<const T, AbstractTyped>>(this->m_getter, this->m_elementGetter);
+    value->m_refGetter = this->m_refGetter;
+
+    return std::unique_ptr<AbstractTyped>(std::move(value));
 }
 
 template <typename T, typename BASE>
@@ -184,5 +304,12 @@ void StoredValueArray<const T, BASE>::setElement(size_t, const typename StoredVa
     // Read-only!
 }
 
+template <typename T, typename BASE>
+size_t StoredValueArray<const T, BASE>::setElements(size_t, size_t, const typename StoredValueArray<T, BASE>::ElementType *)
+{
+    // Read-only!
+    return 0;
+}
+
 
 } // namespace cppexpose
@@ -5,6 +5,8 @@
 #include <functional>
 
 #include <cppexpose/cppexpose_api.h>
+#include <cppexpose/base/Delegate.h>
+#include <cppexpose/base/FreeListPool.h>
 #include <cppexpose/typed/GetTyped.hh>
 
 
@@ -20,6 +22,7 @@ template<typename T, typename Obj>
 struct CPPEXPOSE_TEMPLATE_API SingleValueFunctions
 {
     typedef T (Obj::*getter) () const;
+    typedef const T & (Obj::*refGetter) () const;
     typedef void (Obj::*setter) (const T &);
 };
 
@@ -29,8 +32,12 @@ struct CPPEXPOSE_TEMPLATE_API SingleValueFunctions
 *    Typed value (read/write) that is accessed via getter and setter functions
 */
 template <typename T, typename BASE>
-class CPPEXPOSE_TEMPLATE_API StoredValueSingle : public GetTyped<T, BASE>::Type
+class CPPEXPOSE_TEMPLATE_API StoredValueSingle : public GetTyped<T, BASE>::Type, public PoolAllocated
 {
+    template <typename, typename>
+    friend class StoredValueSingle;
+
+
 public:
     /**
     *  @brief
@@ -50,8 +57,8 @@ public:
     *      StoredValueSingle<int> v(&staticGetter, &staticSetter);
     *      StoredValueSingle<int> v(myValue, &MyValue::value, &MyValue::setValue);
     */
-    StoredValueSingle(std::function<T ()> getter,
-                      std::function<void(const T &)> setter);
+    StoredValueSingle(Delegate<T ()> getter,
+                      Delegate<void(const T &)> setter);
 
     /**
     *  @brief
@@ -69,6 +76,26 @@ public:
                       typename SingleValueFunctions<T, Obj>::getter getter,
                       typename SingleValueFunctions<T, Obj>::setter setter);
 
+    /**
+    *  @brief
+    *    Constructor
+    *
+    *  @param[in] obj
+    *    Object pointer
+    *  @param[in] getter
+    *    Member function that returns a reference to the value
+    *  @param[in] setter
+    *    Member function to set the value
+    *
+    *  @remarks
+    *    The value is read directly through the returned reference,
+    *    so it is not copied and ptr() const points to it.
+    */
+    template <typename Obj>
+    StoredValueSingle(Obj * obj,
+                      typename SingleValueFunctions<T, Obj>::refGetter getter,
+                      typename SingleValueFunctions<T, Obj>::setter setter);
+
     /**
     *  @brief
     *    Destructor
@@ -99,12 +126,13 @@ protected:
     *  @param[in] getter
     *    Function to get the value
     */
-    StoredValueSingle(const std::function<T ()> & getter);
+    StoredValueSingle(Delegate<T ()> getter);
 
 
 protected:
-    std::function<T ()>            m_getter; ///< Function to get the value
-    std::function<void(const T &)> m_setter; ///< Function to set the value
+    Delegate<T ()>            m_getter;    ///< Function to get the value
+    Delegate<const T * ()>    m_refGetter; ///< Function to get a pointer to the value (empty if the value is not accessible by reference)
+    Delegate<void(const T &)> m_setter;    ///< Function to set the value
 };
 
 
@@ -123,7 +151,7 @@ public:
     *  @param[in] getter
     *    Function to get the value
     */
-    StoredValueSingle(std::function<T ()> getter);
+    StoredValueSingle(Delegate<T ()> getter);
 
     /**
     *  @brief
@@ -138,6 +166,19 @@ public:
     StoredValueSingle(Obj * obj,
                       typename SingleValueFunctions<T, Obj>::getter getter);
 
+    /**
+    *  @brief
+    *    Constructor
+    *
+    *  @param[in] obj
+    *    Object pointer
+    *  @param[in] getter
+    *    Member function that returns a reference to the value
+    */
+    template <typename Obj>
+    StoredValueSingle(Obj * obj,
+                      typename SingleValueFunctions<T, Obj>::refGetter getter);
+
     /**
     *  @brief
     *    Destructor
@@ -9,10 +9,10 @@ namespace cppexpose
 // Read/write type
 template <typename T, typename BASE>
 StoredValueSingle<T, BASE>::StoredValueSingle(
-    std::function<T ()> getter
-  , std::function<void(const T &)> setter)
-: m_getter(getter)
-, m_setter(setter)
+    Delegate<T ()> getter
+  , Delegate<void(const T &)> setter)
+: m_getter(std::move(getter))
+, m_setter(std::move(setter))
 {
 }
 
@@ -37,6 +37,32 @@ StoredValueSingle<T, BASE>::StoredValueSingle(
     };
 }
 
+template <typename T, typename BASE>
+template <typename Obj>
+StoredValueSingle<T, BASE>::StoredValueSingle(
+    Obj * obj,
+    typename SingleValueFunctions<T, Obj>::refGetter g,
+    typename SingleValueFunctions<T, Obj>::setter s)
+{
+    typename SingleValueFunctions<T, Obj>::refGetter getter = g;
+    typename SingleValueFunctions<T, Obj>::setter setter = s;
+
+    m_getter = [obj, getter] () -> T
+    {
+        return (obj->*getter)();
+    };
+
+    m_refGetter = [obj, getter] () -> const T *
+    {
+        return &(obj->*getter)();
+    };
+
+    m_setter = [obj, setter] (const T & value)
+    {
+        (obj->*setter)(value);
+    };
+}
+
 template <typename T, typename BASE>
 StoredValueSingle<T, BASE>::~StoredValueSingle()
 {
@@ -45,18 +71,29 @@ StoredValueSingle<T, BASE>::~StoredValueSingle()
 template <typename T, typename BASE>
 std::unique_ptr<AbstractTyped> StoredValueSingle<T, BASE>::clone() const
 {
-    return cppassist::make_unique<StoredValueSingle<T, AbstractTyped>>(m_getter, m_setter);
+    auto value = cppassist::make_unique<StoredValueSingle<T, AbstractTyped>>(m_getter, m_setter);
+    value->m_refGetter = m_refGetter;
+
+    return std::unique_ptr<AbstractTyped>(std::move(value));
 }
 
 template <typename T, typename BASE>
 T StoredValueSingle<T, BASE>::value() const
 {
+    if (m_refGetter) {
+        return *m_refGetter();
+    }
+
     return m_getter();
 }
 
 template <typename T, typename BASE>
 void StoredValueSingle<T, BASE>::setValue(const T & value)
 {
+    if (this->skipsUnchangedValues() && (m_refGetter ? this->isEqual(*m_refGetter(), value) : this->isEqual(m_getter(), value))) {
+        return;
+    }
+
     m_setter(value);
     this->onValueChanged(value);
 }
@@ -64,7 +101,7 @@ void StoredValueSingle<T, BASE>::setValue(const T & value)
 template <typename T, typename BASE>
 const T * StoredValueSingle<T, BASE>::ptr() const
 {
-    return nullptr;
+    return m_refGetter ? m_refGetter() : nullptr;
 }
 
 template <typename T, typename BASE>
@@ -79,16 +116,16 @@ StoredValueSingle<T, BASE>::StoredValueSingle()
 }
 
 template <typename T, typename BASE>
-StoredValueSingle<T, BASE>::StoredValueSingle(const std::function<T ()> & getter)
-: m_getter(getter)
+StoredValueSingle<T, BASE>::StoredValueSingle(Delegate<T ()> getter)
+: m_getter(std::move(getter))
 {
 }
 
 
 // Read-only type
 template <typename T, typename BASE>
-StoredValueSingle<const T, BASE>::StoredValueSingle(std::function<T ()> getter)
-: StoredValueSingle<T, BASE>::StoredValueSingle(getter)
+StoredValueSingle<const T, BASE>::StoredValueSingle(Delegate<T ()> getter)
+: StoredValueSingle<T, BASE>::StoredValueSingle(std::move(getter))
 {
 }
 
@@ -106,6 +143,25 @@ StoredValueSingle<const T, BASE>::StoredValueSingle(
     };
 }
 
+template <typename T, typename BASE>
+template <typename Obj>
+StoredValueSingle<const T, BASE>::StoredValueSingle(
+    Obj * obj,
+    typename SingleValueFunctions<T, Obj>::refGetter g)
+{
+    typename SingleValueFunctions<T, Obj>::refGetter getter = g;
+
+    this->m_getter = [obj, getter] () -> T
+    {
+        return (obj->*getter)();
+    };
+
+    this->m_refGetter = [obj, getter] () -> const T *
+    {
+        return &(obj->*getter)();
+    };
+}
+
 template <typename T, typename BASE>
 StoredValueSingle<const T, BASE>::~StoredValueSingle()
 {
@@ -114,7 +170,10 @@ StoredValueSingle<const T, BASE>::~StoredValueSingle()
 template <typename T, typename BASE>
 std::unique_ptr<AbstractTyped> StoredValueSingle<const T, BASE>::clone() const
 {
-    return cppassist::make_unique<StoredValueSingle<const T, AbstractTyped>>(this->m_getter);
+    auto value = cppassist::make_unique<StoredValueSingle<const T, AbstractTyped>>(this->m_getter);
+    value->m_refGetter = this->m_refGetter;
+
+    return std::unique_ptr<AbstractTyped>(std::move(value));
 }
 
 template <typename T, typename BASE>
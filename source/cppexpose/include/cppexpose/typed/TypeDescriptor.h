@@ -0,0 +1,153 @@
+
+#pragma once
+
+
+#include <string>
+#include <typeinfo>
+
+#include <cppexpose/cppexpose_api.h>
+
+
+namespace cppexpose
+{
+
+
+/**
+*  @brief
+*    Static description of a data type
+*
+*    There is one descriptor per data type, which is created on first use and
+*    shared by all typed values of that type (see AbstractTyped::typeDescriptor()).
+*    It provides the type information that does not depend on a specific value,
+*    so code that inspects many values, e.g., user interfaces or serializers,
+*    can read all of it with a single virtual call.
+*/
+class CPPEXPOSE_API TypeDescriptor
+{
+public:
+    /**
+    *  @brief
+    *    Type flags
+    */
+    enum Flags : unsigned int
+    {
+        None             = 0,
+        Enum             = 1 << 0,  ///< Enum type (see TypeInterface::isEnum())
+        Array            = 1 << 1,  ///< Array or vector type (see TypeInterface::isArray())
+        Variant          = 1 << 2,  ///< cppexpose::Variant (see TypeInterface::isVariant())
+        String           = 1 << 3,  ///< String type (see TypeInterface::isString())
+        Bool             = 1 << 4,  ///< Boolean type (see TypeInterface::isBool())
+        Number           = 1 << 5,  ///< Number type (see TypeInterface::isNumber())
+        Integral         = 1 << 6,  ///< Integral type (see TypeInterface::isIntegral())
+        SignedIntegral   = 1 << 7,  ///< Signed integral type (see TypeInterface::isSignedIntegral())
+        UnsignedIntegral = 1 << 8,  ///< Unsigned integral type (see TypeInterface::isUnsignedIntegral())
+        FloatingPoint    = 1 << 9,  ///< Floating point type (see TypeInterface::isFloatingPoint())
+        Composite        = 1 << 10  ///< Type with sub-values (see AbstractTyped::isComposite())
+    };
+
+
+public:
+    /**
+    *  @brief
+    *    Constructor
+    *
+    *  @param[in] type
+    *    Type id
+    *  @param[in] name
+    *    Human-readable type name
+    *  @param[in] size
+    *    Size of the data type (in bytes)
+    *  @param[in] flags
+    *    Combination of type flags
+    *  @param[in] elementType
+    *    Descriptor of the element type for arrays and vectors (can be null)
+    *  @param[in] numElements
+    *    Number of elements for arrays with fixed size (0 for other types)
+    */
+    TypeDescriptor(const std::type_info & type, const std::string & name, size_t size, unsigned int flags,
+                   const TypeDescriptor * elementType = nullptr, size_t numElements = 0);
+
+    /**
+    *  @brief
+    *    Destructor
+    */
+    ~TypeDescriptor();
+
+    /**
+    *  @brief
+    *    Get type
+    *
+    *  @return
+    *    Type id
+    */
+    const std::type_info & type() const;
+
+    /**
+    *  @brief
+    *    Get human-readable type name
+    *
+    *  @return
+    *    Type name
+    */
+    const std::string & name() const;
+
+    /**
+    *  @brief
+    *    Get size of the data type
+    *
+    *  @return
+    *    Size (in bytes)
+    */
+    size_t size() const;
+
+    /**
+    *  @brief
+    *    Get type flags
+    *
+    *  @return
+    *    Combination of type flags
+    */
+    unsigned int flags() const;
+
+    /**
+    *  @brief
+    *    Check if all given type flags are set
+    *
+    *  @param[in] flags
+    *    Combination of type flags
+    *
+    *  @return
+    *    'true' if all flags are set, else 'false'
+    */
+    bool is(unsigned int flags) const;
+
+    /**
+    *  @brief
+    *    Get descriptor of the element type
+    *
+    *  @return
+    *    Descriptor of the element type for arrays and vectors, else nullptr
+    */
+    const TypeDescriptor * elementType() const;
+
+    /**
+    *  @brief
+    *    Get number of elements
+    *
+    *  @return
+    *    Number of elements for arrays with fixed size, else 0
+    */
+    size_t numElements() const;
+
+
+protected:
+    const std::type_info   & m_type;        ///< Type id
+    std::string              m_name;        ///< Human-readable type name
+    size_t                   m_size;        ///< Size of the data type (in bytes)
+    unsigned int             m_flags;       ///< Combination of type flags
+    const TypeDescriptor   * m_elementType; ///< Descriptor of the element type (can be null)
+    size_t                   m_numElements; ///< Number of elements for arrays with fixed size
+};
+
+
+} // namespace cppexpose
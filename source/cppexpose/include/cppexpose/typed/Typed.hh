@@ -95,8 +95,22 @@ public:
     */
     virtual T * ptr() = 0;
 
+    /**
+    *  @brief
+    *    Get type descriptor
+    *
+    *  @return
+    *    Descriptor of the data type T
+    *
+    *  @remarks
+    *    This describes types without a specific typed class (see TypedGeneric).
+    *    The typed classes for other types provide their own descriptor().
+    */
+    static const TypeDescriptor & descriptor();
+
     // Virtual AbstractTyped interface
     virtual const std::type_info & type() const override;
+    virtual const TypeDescriptor & typeDescriptor() const override;
     virtual bool isReadOnly() const override;
 
     virtual bool isComposite() const override;
@@ -130,6 +144,56 @@ public:
 
 protected:
     virtual void onValueChanged(const T & value);
+
+    /**
+    *  @brief
+    *    Get current value without copying it, if it is accessible through ptr()
+    *
+    *  @param[out] copy
+    *    Storage for a copy of the value (only used if ptr() returns null)
+    *
+    *  @return
+    *    Reference to the value
+    */
+    const T & readValue(T & copy) const;
+
+    /**
+    *  @brief
+    *    Compare values for skipping unchanged values (see skipsUnchangedValues())
+    *
+    *  @param[in] current
+    *    Current value
+    *  @param[in] value
+    *    New value
+    *
+    *  @return
+    *    'true' if both values are equal, 'false' if they differ or cannot be compared
+    */
+    template <typename V>
+    static bool isEqual(const V & current, const V & value);
+
+    /**
+    *  @brief
+    *    Compare ranges of values for skipping unchanged values (see skipsUnchangedValues())
+    *
+    *  @param[in] current
+    *    Current values
+    *  @param[in] values
+    *    New values
+    *  @param[in] count
+    *    Number of values
+    *
+    *  @return
+    *    'true' if all values are equal, 'false' if any of them differ or cannot be compared
+    */
+    template <typename V>
+    static bool isEqualRange(const V * current, const V * values, size_t count);
+
+    template <typename V>
+    static bool isEqual(const V & current, const V & value, std::true_type comparable);
+
+    template <typename V>
+    static bool isEqual(const V & current, const V & value, std::false_type comparable);
 };
 
 
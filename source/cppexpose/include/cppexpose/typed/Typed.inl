@@ -4,6 +4,7 @@
 
 #include <typeinfo>
 
+#include <cppexpose/base/template_helpers.h>
 #include <cppexpose/variant/Variant.hh>
 
 
@@ -33,6 +34,21 @@ const std::type_info & Typed<T, BASE>::type() const
     return typeid(T);
 }
 
+template <typename T, typename BASE>
+const TypeDescriptor & Typed<T, BASE>::descriptor()
+{
+    static const TypeDescriptor descriptor(typeid(T), "unknown", sizeof(T), TypeDescriptor::None);
+
+    return descriptor;
+}
+
+template <typename T, typename BASE>
+const TypeDescriptor & Typed<T, BASE>::typeDescriptor() const
+{
+    // Use the descriptor of the typed class for T, which is the same for all BASE classes
+    return GetTyped<T, AbstractTyped>::Type::descriptor();
+}
+
 template <typename T, typename BASE>
 bool Typed<T, BASE>::isReadOnly() const
 {
@@ -120,6 +136,10 @@ bool Typed<T, BASE>::isFloatingPoint() const
 template <typename T, typename BASE>
 Variant Typed<T, BASE>::toVariant() const
 {
+    if (const T * value = this->ptr()) {
+        return Variant::fromValue<T>(*value);
+    }
+
     return Variant::fromValue<T>(this->value());
 }
 
@@ -206,5 +226,52 @@ void Typed<T, BASE>::onValueChanged(const T &)
     // To be implemented in derived classes
 }
 
+template <typename T, typename BASE>
+const T & Typed<T, BASE>::readValue(T & copy) const
+{
+    if (const T * value = this->ptr()) {
+        return *value;
+    }
+
+    copy = this->value();
+    return copy;
+}
+
+template <typename T, typename BASE>
+template <typename V>
+bool Typed<T, BASE>::isEqual(const V & current, const V & value)
+{
+    return isEqual(current, value, std::integral_constant<bool, helper::isEqualityComparable<V>::value>());
+}
+
+template <typename T, typename BASE>
+template <typename V>
+bool Typed<T, BASE>::isEqualRange(const V * current, const V * values, size_t count)
+{
+    for (size_t i=0; i<count; i++)
+    {
+        if (!isEqual(current[i], values[i])) {
+            return false;
+        }
+    }
+
+    return true;
+}
+
+template <typename T, typename BASE>
+template <typename V>
+bool Typed<T, BASE>::isEqual(const V & current, const V & value, std::true_type)
+{
+    return current == value;
+}
+
+template <typename T, typename BASE>
+template <typename V>
+bool Typed<T, BASE>::isEqual(const V &, const V &, std::false_type)
+{
+    // Values that cannot be compared are always considered as changed
+    return false;
+}
+
 
 } // namespace cppexpose
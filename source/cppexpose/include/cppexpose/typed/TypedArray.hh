@@ -12,6 +12,10 @@ namespace cppexpose
 {
 
 
+template <typename ET, typename ARRAY>
+class ArrayElement;
+
+
 /**
 *  @brief
 *    Representation of a typed array
@@ -104,6 +108,51 @@ public:
     */
     virtual void setElement(size_t i, const ET & value) = 0;
 
+    /**
+    *  @brief
+    *    Get range of array elements
+    *
+    *  @param[in] first
+    *    Index of first element
+    *  @param[in] count
+    *    Number of elements
+    *  @param[out] elements
+    *    Destination for at least count elements
+    *
+    *  @return
+    *    Number of elements that have been copied (the range is clipped to the array size)
+    */
+    virtual size_t getElements(size_t first, size_t count, ET * elements) const;
+
+    /**
+    *  @brief
+    *    Set range of array elements
+    *
+    *  @param[in] first
+    *    Index of first element
+    *  @param[in] count
+    *    Number of elements
+    *  @param[in] elements
+    *    Source of at least count elements
+    *
+    *  @return
+    *    Number of elements that have been set (the range is clipped to the array size)
+    *
+    *  @remarks
+    *    Unlike calling setElement() for each element, this emits onValueChanged
+    *    only once for the whole range.
+    */
+    virtual size_t setElements(size_t first, size_t count, const ET * elements);
+
+    /**
+    *  @brief
+    *    Get type descriptor
+    *
+    *  @return
+    *    Descriptor of the data type T
+    */
+    static const TypeDescriptor & descriptor();
+
     // Virtual AbstractTyped interface
     virtual std::string typeName() const override;
     virtual bool isComposite() const override;
@@ -115,7 +164,23 @@ public:
 
 
 protected:
-    std::vector<std::unique_ptr<AbstractTyped>> m_subValues; ///< Typed accessors for sub-values (lazy initialized)
+    /**
+    *  @brief
+    *    Get number of elements in a range after clipping it to the array size
+    *
+    *  @param[in] first
+    *    Index of first element
+    *  @param[in] count
+    *    Number of elements
+    *
+    *  @return
+    *    Number of elements in the range that are inside the array
+    */
+    static size_t clipRange(size_t first, size_t count);
+
+
+protected:
+    std::vector<ArrayElement<ET, TypedArray>> m_subValues; ///< Typed accessors for sub-values (lazy initialized)
 };
 
 
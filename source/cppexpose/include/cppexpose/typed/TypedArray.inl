@@ -2,10 +2,10 @@
 #pragma once
 
 
-#include <sstream>
+#include <array>
+#include <string>
 
 #include <cppassist/string/manipulation.h>
-#include <cppassist/memory/make_unique.inl>
 
 
 namespace cppexpose
@@ -15,9 +15,6 @@ namespace cppexpose
 template <typename T, typename BASE>
 class DirectValue;
 
-template <typename T, typename BASE>
-class StoredValue;
-
 
 template <typename T, typename ET, size_t Size, typename BASE>
 TypedArray<T, ET, Size, BASE>::TypedArray()
@@ -36,8 +33,8 @@ TypedArray<T, ET, Size, BASE>::TypedArray(const TypedArray & rhs)
 template <typename T, typename ET, size_t Size, typename BASE>
 TypedArray<T, ET, Size, BASE>::TypedArray(TypedArray && rhs)
 : Typed<T, BASE>(std::move(rhs))
-, m_subValues(std::move(rhs.m_subValues))
 {
+    // don't move m_subValues, as they refer to rhs
 }
 
 template <typename T, typename ET, size_t Size, typename BASE>
@@ -62,7 +59,7 @@ TypedArray<T, ET, Size, BASE> & TypedArray<T, ET, Size, BASE>::operator=(TypedAr
 {
     Typed<T, BASE>::operator=(std::move(rhs));
 
-    m_subValues = std::move(rhs.m_subValues);
+    // don't move m_subValues, as they refer to rhs
 
     return *this;
 }
@@ -74,15 +71,46 @@ size_t TypedArray<T, ET, Size, BASE>::numElements() const
 }
 
 template <typename T, typename ET, size_t Size, typename BASE>
-std::string TypedArray<T, ET, Size, BASE>::typeName() const
+size_t TypedArray<T, ET, Size, BASE>::getElements(size_t first, size_t count, ET * elements) const
+{
+    count = clipRange(first, count);
+
+    for (size_t i=0; i<count; i++) {
+        elements[i] = this->getElement(first + i);
+    }
+
+    return count;
+}
+
+template <typename T, typename ET, size_t Size, typename BASE>
+size_t TypedArray<T, ET, Size, BASE>::setElements(size_t first, size_t count, const ET * elements)
 {
-    // [TODO] This is not nice and potentially expensive.
-    //        Find a better way to get type names.
-    DirectValue<ET> dummy;
+    // Fallback for derived classes that cannot set a range at once
+    count = clipRange(first, count);
+
+    for (size_t i=0; i<count; i++) {
+        this->setElement(first + i, elements[i]);
+    }
+
+    return count;
+}
+
+template <typename T, typename ET, size_t Size, typename BASE>
+const TypeDescriptor & TypedArray<T, ET, Size, BASE>::descriptor()
+{
+    static const TypeDescriptor & elementType = GetTyped<ET, AbstractTyped>::Type::descriptor();
+
+    static const TypeDescriptor descriptor(typeid(T),
+        "array<" + elementType.name() + ", " + std::to_string(Size) + ">",
+        sizeof(T), TypeDescriptor::Array | TypeDescriptor::Composite, &elementType, Size);
 
-    std::stringstream s;
-    s << "array<" << dummy.typeName() << ", " << Size << ">";
-    return s.str();
+    return descriptor;
+}
+
+template <typename T, typename ET, size_t Size, typename BASE>
+std::string TypedArray<T, ET, Size, BASE>::typeName() const
+{
+    return descriptor().name();
 }
 
 template <typename T, typename ET, size_t Size, typename BASE>
@@ -100,24 +128,22 @@ size_t TypedArray<T, ET, Size, BASE>::numSubValues() const
 template <typename T, typename ET, size_t Size, typename BASE>
 AbstractTyped * TypedArray<T, ET, Size, BASE>::subValue(size_t index)
 {
-    // Create typed accessor for sub-values on first call to this function
+    if (index >= Size) {
+        return nullptr;
+    }
+
+    // Create typed accessors for sub-values on first call to this function (in a single allocation)
     if (m_subValues.empty())
     {
-        for (size_t i=0; i<Size; i++)
-        {
-            m_subValues.push_back(cppassist::make_unique<StoredValue<ET>>(
-                [this, i] () -> ET {
-                    return this->getElement(i);
-                },
-                [this, i] (const ET & value) {
-                    this->setElement(i, value);
-                }
-            ));
+        m_subValues.reserve(Size);
+
+        for (size_t i=0; i<Size; i++) {
+            m_subValues.emplace_back(this, i);
         }
     }
 
     // Return sub-value accessor
-    return (index < Size) ? m_subValues[index].get() : nullptr;
+    return &m_subValues[index];
 }
 
 template <typename T, typename ET, size_t Size, typename BASE>
@@ -129,11 +155,14 @@ bool TypedArray<T, ET, Size, BASE>::isArray() const
 template <typename T, typename ET, size_t Size, typename BASE>
 std::string TypedArray<T, ET, Size, BASE>::toString() const
 {
+    std::array<ET, Size> elements;
+    this->getElements(0, Size, elements.data());
+
     std::string str = "(";
 
     for (size_t i=0; i<Size; i++) {
         if (i > 0) str += ", ";
-        str += const_cast<TypedArray<T, ET, Size, BASE> *>(this)->subValue(i)->toString();
+        str += DirectValue<ET>(elements[i]).toString();
     }
 
     str += ")";
@@ -149,15 +178,33 @@ bool TypedArray<T, ET, Size, BASE>::fromString(const std::string & value)
         return false;
     }
 
+    // Parse all elements first, so the array is either updated at once or not at all
+    std::array<ET, Size> elements;
+    DirectValue<ET> element;
+
     for (size_t i=0; i<Size; i++)
     {
-        if (!this->subValue(i)->fromString(elementStrings[i])) {
+        if (!element.fromString(elementStrings[i])) {
             return false;
         }
+
+        elements[i] = element.value();
     }
 
+    this->setElements(0, Size, elements.data());
+
     return true;
 }
 
+template <typename T, typename ET, size_t Size, typename BASE>
+size_t TypedArray<T, ET, Size, BASE>::clipRange(size_t first, size_t count)
+{
+    if (first >= Size) {
+        return 0;
+    }
+
+    return (count < Size - first) ? count : Size - first;
+}
+
 
 } // namespace cppexpose
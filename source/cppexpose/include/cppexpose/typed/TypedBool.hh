@@ -30,6 +30,15 @@ public:
     */
     virtual ~TypedBool();
 
+    /**
+    *  @brief
+    *    Get type descriptor
+    *
+    *  @return
+    *    Descriptor of the data type T
+    */
+    static const TypeDescriptor & descriptor();
+
     // Virtual AbstractTyped interface
     virtual std::string typeName() const override;
     virtual bool isBool() const override;
@@ -16,10 +16,18 @@ TypedBool<T, BASE>::~TypedBool()
 {
 }
 
+template <typename T, typename BASE>
+const TypeDescriptor & TypedBool<T, BASE>::descriptor()
+{
+    static const TypeDescriptor descriptor(typeid(T), "bool", sizeof(T), TypeDescriptor::Bool);
+
+    return descriptor;
+}
+
 template <typename T, typename BASE>
 std::string TypedBool<T, BASE>::typeName() const
 {
-    return "bool";
+    return descriptor().name();
 }
 
 template <typename T, typename BASE>
@@ -5,6 +5,7 @@
 #include <string>
 #include <vector>
 #include <map>
+#include <memory>
 
 #include <cppexpose/cppexpose_api.h>
 #include <cppexpose/typed/Typed.hh>
@@ -14,9 +15,16 @@ namespace cppexpose
 {
 
 
+template <typename T>
+class EnumStringTable;
+
+
 /**
 *  @brief
 *    Representation of an enum value
+*
+*    The string representations of the enum values are shared by all
+*    values of the same enum type, unless they are changed by setStrings().
 */
 template <typename T, typename BASE>
 class CPPEXPOSE_TEMPLATE_API TypedEnum : public Typed<T, BASE>
@@ -28,6 +36,10 @@ public:
     *
     *  @return
     *    Property options
+    *
+    *  @remarks
+    *    The options are created only once for each enum type.
+    *    They are shared, so they can be copied in constant time.
     */
     static Variant defaultOptions();
 
@@ -63,6 +75,15 @@ public:
     */
     void setStrings(const std::map<T, std::string> & pairs);
 
+    /**
+    *  @brief
+    *    Get type descriptor
+    *
+    *  @return
+    *    Descriptor of the data type T
+    */
+    static const TypeDescriptor & descriptor();
+
     // Virtual Typed<T> interface
     virtual std::string typeName() const override;
     virtual bool isNumber() const override;
@@ -82,8 +103,18 @@ public:
 
 
 protected:
-    std::map<T, std::string> m_stringMap;
-    std::map<std::string, T> m_enumMap;
+    /**
+    *  @brief
+    *    Get string table
+    *
+    *  @return
+    *    Strings set by setStrings(), or the default strings of the enum type
+    */
+    const EnumStringTable<T> & stringTable() const;
+
+
+protected:
+    std::shared_ptr<const EnumStringTable<T>> m_strings; ///< Strings set by setStrings() (null if the default strings are used)
 };
 
 
@@ -107,4 +138,75 @@ struct CPPEXPOSE_TEMPLATE_API EnumDefaultStrings
 };
 
 
+/**
+*  @brief
+*    Mapping between enum values and their string representations
+*
+*    Values and strings are kept in sorted arrays, so both directions
+*    are looked up by binary search without additional allocations.
+*/
+template <typename T>
+class CPPEXPOSE_TEMPLATE_API EnumStringTable
+{
+public:
+    /**
+    *  @brief
+    *    Get table of the default strings of the enum type
+    *
+    *  @return
+    *    Table that is created from EnumDefaultStrings<T> on first use
+    */
+    static const EnumStringTable & defaultTable();
+
+
+public:
+    /**
+    *  @brief
+    *    Constructor
+    *
+    *  @param[in] pairs
+    *    Map of values and strings (strings must be unique)
+    */
+    EnumStringTable(const std::map<T, std::string> & pairs);
+
+    /**
+    *  @brief
+    *    Get string representation of a value
+    *
+    *  @param[in] value
+    *    Enum value
+    *
+    *  @return
+    *    Pointer to the string, nullptr if the value has no string representation
+    */
+    const std::string * string(T value) const;
+
+    /**
+    *  @brief
+    *    Get value of a string representation
+    *
+    *  @param[in] str
+    *    String representation
+    *
+    *  @return
+    *    Pointer to the value, nullptr if the string is unknown
+    */
+    const T * value(const std::string & str) const;
+
+    /**
+    *  @brief
+    *    Get all string representations
+    *
+    *  @return
+    *    List of strings, ordered by value
+    */
+    std::vector<std::string> strings() const;
+
+
+protected:
+    std::vector<std::pair<T, std::string>> m_pairs;   ///< Values and strings, ordered by value
+    std::vector<size_t>                    m_byString; ///< Indices into m_pairs, ordered by string
+};
+
+
 } // namespace cppexpose
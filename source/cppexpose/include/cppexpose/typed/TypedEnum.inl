@@ -2,6 +2,7 @@
 #pragma once
 
 
+#include <algorithm>
 #include <cassert>
 #include <type_traits>
 
@@ -13,22 +14,27 @@ namespace cppexpose
 template <typename T, typename BASE>
 Variant TypedEnum<T, BASE>::defaultOptions()
 {
-    // Get default strings
-    auto defaultsMap = EnumDefaultStrings<T>()();
-
-    // Convert into choices enum
-    VariantArray choices;
-    for (const auto & it : defaultsMap)
+    static const Variant options = [] ()
     {
-        choices.push_back(Variant(it.second));
-    }
+        // Convert default strings into choices
+        Variant choices = Variant::array();
+        for (const auto & str : EnumStringTable<T>::defaultTable().strings())
+        {
+            choices.asArray()->push_back(Variant(str));
+        }
+
+        // Share choices, because they are copied into the options of each property
+        choices.share();
+
+        // Create property options
+        Variant options = Variant::map();
+        (*options.asMap())["choices"] = choices;
+        options.share();
 
-    // Create property options
-    VariantMap options;
-    options["choices"] = Variant(choices);
+        return options;
+    }();
 
-    // Return options
-    return Variant(options);
+    return options;
 }
 
 
@@ -36,8 +42,6 @@ template <typename T, typename BASE>
 TypedEnum<T, BASE>::TypedEnum()
 : Typed<T, BASE>(TypedEnum<T, BASE>::defaultOptions())
 {
-    // Create default enum strings
-    this->setStrings(EnumDefaultStrings<T>()());
 }
 
 template <typename T, typename BASE>
@@ -48,34 +52,28 @@ TypedEnum<T, BASE>::~TypedEnum()
 template <typename T, typename BASE>
 std::vector<std::string> TypedEnum<T, BASE>::strings() const
 {
-    std::vector<std::string> strings;
-
-    for (auto element : m_stringMap) {
-        strings.push_back(element.second);
-    }
-
-    return strings;
+    return stringTable().strings();
 }
 
 template <typename T, typename BASE>
 void TypedEnum<T, BASE>::setStrings(const std::map<T, std::string> & pairs)
 {
-    // Save map of enum value -> string representation
-    m_stringMap = pairs;
+    // Replace the default strings for this value only
+    m_strings = std::make_shared<EnumStringTable<T>>(pairs);
+}
 
-    // Construct reverse map (string -> enum value)
-    m_enumMap.clear();
-    for (const std::pair<T, std::string> & pair : pairs)
-    {
-        assert(m_enumMap.count(pair.second) == 0);
-        m_enumMap.insert(std::make_pair(pair.second, pair.first));
-    }
+template <typename T, typename BASE>
+const TypeDescriptor & TypedEnum<T, BASE>::descriptor()
+{
+    static const TypeDescriptor descriptor(typeid(T), "enum", sizeof(T), TypeDescriptor::Number | TypeDescriptor::Integral);
+
+    return descriptor;
 }
 
 template <typename T, typename BASE>
 std::string TypedEnum<T, BASE>::typeName() const
 {
-    return "enum";
+    return descriptor().name();
 }
 
 template <typename T, typename BASE>
@@ -114,11 +112,11 @@ template <typename T, typename BASE>
 std::string TypedEnum<T, BASE>::toString() const
 {
     // Check if value has a string representation
-    const auto it = m_stringMap.find(this->value());
+    const std::string * str = stringTable().string(this->value());
 
     // Return string representation
-    if (it != m_stringMap.cend()) {
-        return it->second;
+    if (str) {
+        return *str;
     }
 
     return "";
@@ -128,15 +126,15 @@ template <typename T, typename BASE>
 bool TypedEnum<T, BASE>::fromString(const std::string & value)
 {
     // Find enum of string representation
-    auto it = m_enumMap.find(value);
+    const T * enumValue = stringTable().value(value);
 
     // Abort if it is not available
-    if (it == m_enumMap.end()) {
+    if (!enumValue) {
         return false;
     }
 
     // Set value
-    this->setValue((*it).second);
+    this->setValue(*enumValue);
     return true;
 }
 
@@ -192,6 +190,12 @@ bool TypedEnum<T, BASE>::fromDouble(double value)
     return true;
 }
 
+template <typename T, typename BASE>
+const EnumStringTable<T> & TypedEnum<T, BASE>::stringTable() const
+{
+    return m_strings ? *m_strings : EnumStringTable<T>::defaultTable();
+}
+
 
 template <typename T>
 std::map<T, std::string> EnumDefaultStrings<T>::operator()()
@@ -200,4 +204,78 @@ std::map<T, std::string> EnumDefaultStrings<T>::operator()()
 }
 
 
+template <typename T>
+const EnumStringTable<T> & EnumStringTable<T>::defaultTable()
+{
+    static const EnumStringTable table = EnumStringTable(EnumDefaultStrings<T>()());
+
+    return table;
+}
+
+template <typename T>
+EnumStringTable<T>::EnumStringTable(const std::map<T, std::string> & pairs)
+: m_pairs(pairs.begin(), pairs.end())
+{
+    // Sort indices by string for the reverse lookup
+    m_byString.reserve(m_pairs.size());
+    for (size_t i = 0; i < m_pairs.size(); ++i) {
+        m_byString.push_back(i);
+    }
+
+    std::sort(m_byString.begin(), m_byString.end(), [this] (size_t lhs, size_t rhs)
+    {
+        return m_pairs[lhs].second < m_pairs[rhs].second;
+    });
+
+    assert(std::adjacent_find(m_byString.begin(), m_byString.end(), [this] (size_t lhs, size_t rhs)
+    {
+        return m_pairs[lhs].second == m_pairs[rhs].second;
+    }) == m_byString.end());
+}
+
+template <typename T>
+const std::string * EnumStringTable<T>::string(T value) const
+{
+    // Pairs are ordered by value, like in the map they have been created from
+    const auto it = std::lower_bound(m_pairs.begin(), m_pairs.end(), value, [] (const std::pair<T, std::string> & pair, T v)
+    {
+        return pair.first < v;
+    });
+
+    if (it == m_pairs.end() || value < it->first) {
+        return nullptr;
+    }
+
+    return &it->second;
+}
+
+template <typename T>
+const T * EnumStringTable<T>::value(const std::string & str) const
+{
+    const auto it = std::lower_bound(m_byString.begin(), m_byString.end(), str, [this] (size_t index, const std::string & s)
+    {
+        return m_pairs[index].second < s;
+    });
+
+    if (it == m_byString.end() || m_pairs[*it].second != str) {
+        return nullptr;
+    }
+
+    return &m_pairs[*it].first;
+}
+
+template <typename T>
+std::vector<std::string> EnumStringTable<T>::strings() const
+{
+    std::vector<std::string> strings;
+    strings.reserve(m_pairs.size());
+
+    for (const auto & pair : m_pairs) {
+        strings.push_back(pair.second);
+    }
+
+    return strings;
+}
+
+
 } // namespace cppexpose
@@ -30,6 +30,15 @@ public:
     */
     virtual ~TypedFilePath();
 
+    /**
+    *  @brief
+    *    Get type descriptor
+    *
+    *  @return
+    *    Descriptor of the data type T
+    */
+    static const TypeDescriptor & descriptor();
+
     // Virtual AbstractTyped interface
     virtual std::string typeName() const override;
     bool isString() const override;
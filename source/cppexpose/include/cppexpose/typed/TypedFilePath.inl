@@ -47,10 +47,18 @@ bool TypedFilePath<T, BASE>::fromVariant(const Variant & variant)
     return this->fromString(variant.value<std::string>());
 }
 
+template <typename T, typename BASE>
+const TypeDescriptor & TypedFilePath<T, BASE>::descriptor()
+{
+    static const TypeDescriptor descriptor(typeid(T), "filename", sizeof(T), TypeDescriptor::String);
+
+    return descriptor;
+}
+
 template <typename T, typename BASE>
 std::string TypedFilePath<T, BASE>::typeName() const
 {
-    return "filename";
+    return descriptor().name();
 }
 
 
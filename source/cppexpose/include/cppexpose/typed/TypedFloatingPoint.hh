@@ -30,9 +30,20 @@ public:
     */
     virtual ~TypedFloatingPoint();
 
+    /**
+    *  @brief
+    *    Get type descriptor
+    *
+    *  @return
+    *    Descriptor of the data type T
+    */
+    static const TypeDescriptor & descriptor();
+
     // Virtual AbstractTyped interface
     virtual std::string typeName() const override;
     virtual bool isFloatingPoint() const override;
+    virtual std::string toString() const override;
+    virtual bool fromString(const std::string & value) override;
 };
 
 
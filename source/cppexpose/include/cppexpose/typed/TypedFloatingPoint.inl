@@ -2,6 +2,11 @@
 #pragma once
 
 
+#include <type_traits>
+
+#include <cppexpose/base/number_helpers.h>
+
+
 namespace cppexpose
 {
 
@@ -16,12 +21,20 @@ TypedFloatingPoint<T, BASE>::~TypedFloatingPoint()
 {
 }
 
+template <typename T, typename BASE>
+const TypeDescriptor & TypedFloatingPoint<T, BASE>::descriptor()
+{
+    static const TypeDescriptor descriptor(typeid(T),
+        (sizeof(T) > sizeof(float)) ? "double" : (sizeof(T) == sizeof(float)) ? "float" : "half",
+        sizeof(T), TypeDescriptor::Number | TypeDescriptor::FloatingPoint);
+
+    return descriptor;
+}
+
 template <typename T, typename BASE>
 std::string TypedFloatingPoint<T, BASE>::typeName() const
 {
-         if (sizeof(T)  > sizeof(float)) return "double";
-    else if (sizeof(T) == sizeof(float)) return "float";
-    else                                 return "half";
+    return descriptor().name();
 }
 
 template <typename T, typename BASE>
@@ -30,5 +43,21 @@ bool TypedFloatingPoint<T, BASE>::isFloatingPoint() const
     return true;
 }
 
+template <typename T, typename BASE>
+std::string TypedFloatingPoint<T, BASE>::toString() const
+{
+    // Format float in single precision to get the shortest digits, other types in double precision
+    using Precision = typename std::conditional<std::is_same<T, float>::value, float, double>::type;
+
+    return helper::formatShortestFloatingPoint(static_cast<Precision>(this->value()));
+}
+
+template <typename T, typename BASE>
+bool TypedFloatingPoint<T, BASE>::fromString(const std::string & value)
+{
+    this->setValue(static_cast<T>(helper::parseFloatingPoint(value)));
+    return true;
+}
+
 
 } // namespace cppexpose
@@ -19,7 +19,7 @@ TypedGeneric<T, BASE>::~TypedGeneric()
 template <typename T, typename BASE>
 std::string TypedGeneric<T, BASE>::typeName() const
 {
-    return "unknown";
+    return this->descriptor().name();
 }
 
 
@@ -32,8 +32,6 @@ public:
 
     // Virtual AbstractTyped interface
     virtual bool isNumber() const override;
-    virtual std::string toString() const override;
-    virtual bool fromString(const std::string & value) override;
     virtual bool toBool() const override;
     virtual bool fromBool(bool value) override;
     virtual long long toLongLong() const override;
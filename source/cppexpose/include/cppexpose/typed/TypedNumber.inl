@@ -2,9 +2,6 @@
 #pragma once
 
 
-#include <cppassist/string/conversion.h>
-
-
 namespace cppexpose
 {
 
@@ -25,19 +22,6 @@ bool TypedNumber<T, BASE>::isNumber() const
     return true;
 }
 
-template <typename T, typename BASE>
-std::string TypedNumber<T, BASE>::toString() const
-{
-    return cppassist::string::toString<T>(this->value());
-}
-
-template <typename T, typename BASE>
-bool TypedNumber<T, BASE>::fromString(const std::string & value)
-{
-    this->setValue(cppassist::string::fromString<T>(value));
-    return true;
-}
-
 template <typename T, typename BASE>
 bool TypedNumber<T, BASE>::toBool() const
 {
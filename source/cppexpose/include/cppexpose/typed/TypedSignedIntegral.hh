@@ -30,10 +30,21 @@ public:
     */
     virtual ~TypedSignedIntegral();
 
+    /**
+    *  @brief
+    *    Get type descriptor
+    *
+    *  @return
+    *    Descriptor of the data type T
+    */
+    static const TypeDescriptor & descriptor();
+
     // Virtual AbstractTyped interface
     virtual std::string typeName() const override;
     virtual bool isIntegral() const override;
     virtual bool isSignedIntegral() const override;
+    virtual std::string toString() const override;
+    virtual bool fromString(const std::string & value) override;
 };
 
 
@@ -2,7 +2,7 @@
 #pragma once
 
 
-#include <cppassist/string/conversion.h>
+#include <cppexpose/base/number_helpers.h>
 
 
 namespace cppexpose
@@ -19,10 +19,18 @@ TypedString<T, BASE>::~TypedString()
 {
 }
 
+template <typename T, typename BASE>
+const TypeDescriptor & TypedString<T, BASE>::descriptor()
+{
+    static const TypeDescriptor descriptor(typeid(T), "string", sizeof(T), TypeDescriptor::String);
+
+    return descriptor;
+}
+
 template <typename T, typename BASE>
 std::string TypedString<T, BASE>::typeName() const
 {
-    return "string";
+    return descriptor().name();
 }
 
 template <typename T, typename BASE>
@@ -34,6 +42,10 @@ bool TypedString<T, BASE>::isString() const
 template <typename T, typename BASE>
 std::string TypedString<T, BASE>::toString() const
 {
+    if (const T * value = this->ptr()) {
+        return *value;
+    }
+
     return this->value();
 }
 
@@ -47,7 +59,8 @@ bool TypedString<T, BASE>::fromString(const std::string & value)
 template <typename T, typename BASE>
 bool TypedString<T, BASE>::toBool() const
 {
-    return (this->value() == "true");
+    T copy;
+    return (this->readValue(copy) == "true");
 }
 
 template <typename T, typename BASE>
@@ -60,13 +73,14 @@ bool TypedString<T, BASE>::fromBool(bool value)
 template <typename T, typename BASE>
 long long TypedString<T, BASE>::toLongLong() const
 {
-    return cppassist::string::fromString<long long>(this->value());
+    T copy;
+    return helper::parseInteger(this->readValue(copy));
 }
 
 template <typename T, typename BASE>
 bool TypedString<T, BASE>::fromLongLong(long long value)
 {
-    std::string str = cppassist::string::toString<long long>(value);
+    std::string str = helper::formatInteger(value);
 
     if (str != "") {
         this->setValue(str);
@@ -79,13 +93,14 @@ bool TypedString<T, BASE>::fromLongLong(long long value)
 template <typename T, typename BASE>
 unsigned long long TypedString<T, BASE>::toULongLong() const
 {
-    return cppassist::string::fromString<unsigned long long>(this->value());
+    T copy;
+    return helper::parseUnsignedInteger(this->readValue(copy));
 }
 
 template <typename T, typename BASE>
 bool TypedString<T, BASE>::fromULongLong(unsigned long long value)
 {
-    std::string str = cppassist::string::toString<unsigned long long>(value);
+    std::string str = helper::formatUnsignedInteger(value);
 
     if (str != "") {
         this->setValue(str);
@@ -98,13 +113,14 @@ bool TypedString<T, BASE>::fromULongLong(unsigned long long value)
 template <typename T, typename BASE>
 double TypedString<T, BASE>::toDouble() const
 {
-    return cppassist::string::fromString<double>(this->value());
+    T copy;
+    return helper::parseFloatingPoint(this->readValue(copy));
 }
 
 template <typename T, typename BASE>
 bool TypedString<T, BASE>::fromDouble(double value)
 {
-    std::string str = cppassist::string::toString<double>(value);
+    std::string str = helper::formatShortestFloatingPoint(value);
 
     if (str != "") {
         this->setValue(str);
@@ -2,7 +2,12 @@
 #pragma once
 
 
-#include <sstream>
+#include <algorithm>
+#include <limits>
+#include <string>
+
+#include <cppexpose/base/number_helpers.h>
+#include <cppexpose/base/template_helpers.h>
 
 
 namespace cppexpose
@@ -19,13 +24,19 @@ TypedUnsignedIntegral<T, BASE>::~TypedUnsignedIntegral()
 {
 }
 
+template <typename T, typename BASE>
+const TypeDescriptor & TypedUnsignedIntegral<T, BASE>::descriptor()
+{
+    static const TypeDescriptor descriptor(typeid(T), "uint" + std::to_string(sizeof(T) * 8), sizeof(T),
+        TypeDescriptor::Number | TypeDescriptor::Integral | TypeDescriptor::UnsignedIntegral);
+
+    return descriptor;
+}
+
 template <typename T, typename BASE>
 std::string TypedUnsignedIntegral<T, BASE>::typeName() const
 {
-    std::stringstream s;
-    s << "uint";
-    s << sizeof(T) * 8;
-    return s.str();
+    return descriptor().name();
 }
 
 template <typename T, typename BASE>
@@ -40,5 +51,32 @@ bool TypedUnsignedIntegral<T, BASE>::isUnsignedIntegral() const
     return true;
 }
 
+template <typename T, typename BASE>
+std::string TypedUnsignedIntegral<T, BASE>::toString() const
+{
+    // Characters are output as characters, like in string streams and Variant::toString()
+    if (helper::isCharacter<T>::value) {
+        return std::string(1, static_cast<char>(this->value()));
+    }
+
+    return helper::formatUnsignedInteger(static_cast<unsigned long long>(this->value()));
+}
+
+template <typename T, typename BASE>
+bool TypedUnsignedIntegral<T, BASE>::fromString(const std::string & value)
+{
+    // Characters are read as characters, like in string streams and Variant::value()
+    if (helper::isCharacter<T>::value) {
+        this->setValue(static_cast<T>(helper::parseCharacter(value)));
+        return true;
+    }
+
+    // Clamp to the range of T, like formatted stream input
+    const unsigned long long number = helper::parseUnsignedInteger(value);
+
+    this->setValue(static_cast<T>(std::min<unsigned long long>(number, std::numeric_limits<T>::max())));
+    return true;
+}
+
 
 } // namespace cppexpose
@@ -19,10 +19,18 @@ TypedVariant<T, BASE>::~TypedVariant()
 {
 }
 
+template <typename T, typename BASE>
+const TypeDescriptor & TypedVariant<T, BASE>::descriptor()
+{
+    static const TypeDescriptor descriptor(typeid(T), "variant", sizeof(T), TypeDescriptor::Variant);
+
+    return descriptor;
+}
+
 template <typename T, typename BASE>
 std::string TypedVariant<T, BASE>::typeName() const
 {
-    return "variant";
+    return descriptor().name();
 }
 
 template <typename T, typename BASE>
@@ -31,10 +39,29 @@ bool TypedVariant<T, BASE>::isVariant() const
     return true;
 }
 
+template <typename T, typename BASE>
+Variant TypedVariant<T, BASE>::toVariant() const
+{
+    // Return the variant itself instead of wrapping it into another variant
+    if (const T * value = this->ptr()) {
+        return *value;
+    }
+
+    return this->value();
+}
+
+template <typename T, typename BASE>
+bool TypedVariant<T, BASE>::fromVariant(const Variant & value)
+{
+    this->setValue(value);
+    return true;
+}
+
 template <typename T, typename BASE>
 std::string TypedVariant<T, BASE>::toString() const
 {
-    return this->value().toString();
+    T copy;
+    return this->readValue(copy).toString();
 }
 
 template <typename T, typename BASE>
@@ -47,7 +74,8 @@ bool TypedVariant<T, BASE>::fromString(const std::string & value)
 template <typename T, typename BASE>
 bool TypedVariant<T, BASE>::toBool() const
 {
-    return this->value().toBool();
+    T copy;
+    return this->readValue(copy).toBool();
 }
 
 template <typename T, typename BASE>
@@ -60,7 +88,8 @@ bool TypedVariant<T, BASE>::fromBool(bool value)
 template <typename T, typename BASE>
 long long TypedVariant<T, BASE>::toLongLong() const
 {
-    return this->value().toLongLong();
+    T copy;
+    return this->readValue(copy).toLongLong();
 }
 
 template <typename T, typename BASE>
@@ -73,7 +102,8 @@ bool TypedVariant<T, BASE>::fromLongLong(long long value)
 template <typename T, typename BASE>
 unsigned long long TypedVariant<T, BASE>::toULongLong() const
 {
-    return this->value().toULongLong();
+    T copy;
+    return this->readValue(copy).toULongLong();
 }
 
 template <typename T, typename BASE>
@@ -86,7 +116,8 @@ bool TypedVariant<T, BASE>::fromULongLong(unsigned long long value)
 template <typename T, typename BASE>
 double TypedVariant<T, BASE>::toDouble() const
 {
-    return this->value().toDouble();
+    T copy;
+    return this->readValue(copy).toDouble();
 }
 
 template <typename T, typename BASE>
@@ -0,0 +1,181 @@
+
+#pragma once
+
+
+#include <cppexpose/cppexpose_api.h>
+#include <cppexpose/typed/Typed.hh>
+
+
+namespace cppexpose
+{
+
+
+/**
+*  @brief
+*    Representation of a typed vector (array with dynamic size)
+*
+*    Elements can be accessed one at a time or in contiguous ranges. The default
+*    implementation reads through ptr() if the value is accessible by reference
+*    and otherwise copies the vector, modifications copy the vector, change it
+*    and set it as a whole, which emits a single notification. Typed values that
+*    store the vector directly override these functions to work in place.
+*
+*    Vectors of numbers are converted into packed variant arrays, which are
+*    serialized to JSON without creating a variant per element.
+*
+*  @remarks
+*    Unlike TypedArray, there are no typed accessors for the elements
+*    (subValue()), because they would be invalidated by resizing the vector.
+*
+*    All std::vector types except VariantArray are represented by TypedVector,
+*    including std::vector<std::string>. Their typed values, and variants that
+*    hold them, therefore report isArray() == true and a type name such as
+*    "vector<string>". Variant arrays remain variant values (isArray() == false).
+*/
+template <typename T, typename ET, typename BASE>
+class CPPEXPOSE_TEMPLATE_API TypedVector : public Typed<T, BASE>
+{
+public:
+    typedef ET ElementType;  ///< Type of an element in the vector
+
+
+public:
+    /**
+    *  @brief
+    *    Constructor
+    */
+    TypedVector();
+
+    /**
+    *  @brief
+    *    Destructor
+    */
+    virtual ~TypedVector();
+
+    /**
+    *  @brief
+    *    Get number of elements
+    *
+    *  @return
+    *    Number of elements
+    */
+    virtual size_t numElements() const;
+
+    /**
+    *  @brief
+    *    Change number of elements
+    *
+    *  @param[in] size
+    *    Number of elements (new elements are default-constructed)
+    */
+    virtual void resize(size_t size);
+
+    /**
+    *  @brief
+    *    Get vector element
+    *
+    *  @param[in] i
+    *    Index into vector
+    *
+    *  @return
+    *    Value (default value if the index is out of range)
+    */
+    virtual ET getElement(size_t i) const;
+
+    /**
+    *  @brief
+    *    Set vector element
+    *
+    *  @param[in] i
+    *    Index into vector (ignored if out of range)
+    *  @param[in] value
+    *    Value
+    */
+    virtual void setElement(size_t i, const ET & value);
+
+    /**
+    *  @brief
+    *    Get range of vector elements
+    *
+    *  @param[in] first
+    *    Index of first element
+    *  @param[in] count
+    *    Number of elements
+    *  @param[out] elements
+    *    Destination for at least count elements
+    *
+    *  @return
+    *    Number of elements that have been copied (the range is clipped to the vector size)
+    */
+    virtual size_t getElements(size_t first, size_t count, ET * elements) const;
+
+    /**
+    *  @brief
+    *    Set range of vector elements
+    *
+    *  @param[in] first
+    *    Index of first element
+    *  @param[in] count
+    *    Number of elements
+    *  @param[in] elements
+    *    Source of at least count elements
+    *
+    *  @return
+    *    Number of elements that have been set (the range is clipped to the vector size)
+    *
+    *  @remarks
+    *    This emits onValueChanged only once for the whole range.
+    *    Use resize() first to append elements.
+    */
+    virtual size_t setElements(size_t first, size_t count, const ET * elements);
+
+    /**
+    *  @brief
+    *    Get type descriptor
+    *
+    *  @return
+    *    Descriptor of the data type T
+    */
+    static const TypeDescriptor & descriptor();
+
+    // Virtual AbstractTyped interface
+    virtual std::string typeName() const override;
+    virtual bool isArray() const override;
+    virtual Variant toVariant() const override;
+    virtual bool fromVariant(const Variant & value) override;
+    virtual std::string toString() const override;
+    virtual bool fromString(const std::string & value) override;
+
+
+protected:
+    /**
+    *  @brief
+    *    Get number of elements in a range after clipping it to a vector size
+    *
+    *  @param[in] size
+    *    Number of elements in the vector
+    *  @param[in] first
+    *    Index of first element
+    *  @param[in] count
+    *    Number of elements
+    *
+    *  @return
+    *    Number of elements in the range that are inside the vector
+    */
+    static size_t clipRange(size_t size, size_t first, size_t count);
+
+    /**
+    *  @brief
+    *    Convert vector into a packed variant array (or other built-in variant type)
+    */
+    Variant convertToVariant(const T & value, std::true_type isBuiltIn) const;
+
+    /**
+    *  @brief
+    *    Convert vector into a variant array
+    */
+    Variant convertToVariant(const T & value, std::false_type isBuiltIn) const;
+};
+
+
+} // namespace cppexpose
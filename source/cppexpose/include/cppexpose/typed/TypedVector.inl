@@ -0,0 +1,228 @@
+
+#pragma once
+
+
+#include <cppexpose/variant/Variant.hh>
+
+
+namespace cppexpose
+{
+
+
+template <typename T, typename BASE>
+class DirectValue;
+
+
+template <typename T, typename ET, typename BASE>
+TypedVector<T, ET, BASE>::TypedVector()
+{
+}
+
+template <typename T, typename ET, typename BASE>
+TypedVector<T, ET, BASE>::~TypedVector()
+{
+}
+
+template <typename T, typename ET, typename BASE>
+size_t TypedVector<T, ET, BASE>::numElements() const
+{
+    if (const T * values = this->ptr()) {
+        return values->size();
+    }
+
+    return this->value().size();
+}
+
+template <typename T, typename ET, typename BASE>
+void TypedVector<T, ET, BASE>::resize(size_t size)
+{
+    T values = this->value();
+    values.resize(size);
+
+    this->setValue(values);
+}
+
+template <typename T, typename ET, typename BASE>
+ET TypedVector<T, ET, BASE>::getElement(size_t i) const
+{
+    ET element = ET();
+    this->getElements(i, 1, &element);
+
+    return element;
+}
+
+template <typename T, typename ET, typename BASE>
+void TypedVector<T, ET, BASE>::setElement(size_t i, const ET & value)
+{
+    this->setElements(i, 1, &value);
+}
+
+template <typename T, typename ET, typename BASE>
+size_t TypedVector<T, ET, BASE>::getElements(size_t first, size_t count, ET * elements) const
+{
+    // Read through the reference, if available, to avoid copying the vector
+    T copy;
+    const T & values = this->readValue(copy);
+
+    count = clipRange(values.size(), first, count);
+
+    for (size_t i=0; i<count; i++) {
+        elements[i] = values[first + i];
+    }
+
+    return count;
+}
+
+template <typename T, typename ET, typename BASE>
+size_t TypedVector<T, ET, BASE>::setElements(size_t first, size_t count, const ET * elements)
+{
+    T values = this->value();
+
+    count = clipRange(values.size(), first, count);
+    if (count == 0) {
+        return 0;
+    }
+
+    for (size_t i=0; i<count; i++) {
+        values[first + i] = elements[i];
+    }
+
+    this->setValue(values);
+
+    return count;
+}
+
+template <typename T, typename ET, typename BASE>
+const TypeDescriptor & TypedVector<T, ET, BASE>::descriptor()
+{
+    static const TypeDescriptor & elementType = GetTyped<ET, AbstractTyped>::Type::descriptor();
+
+    static const TypeDescriptor descriptor(typeid(T), "vector<" + elementType.name() + ">",
+        sizeof(T), TypeDescriptor::Array, &elementType);
+
+    return descriptor;
+}
+
+template <typename T, typename ET, typename BASE>
+std::string TypedVector<T, ET, BASE>::typeName() const
+{
+    return descriptor().name();
+}
+
+template <typename T, typename ET, typename BASE>
+bool TypedVector<T, ET, BASE>::isArray() const
+{
+    return true;
+}
+
+template <typename T, typename ET, typename BASE>
+Variant TypedVector<T, ET, BASE>::toVariant() const
+{
+    using IsBuiltIn = std::integral_constant<bool, VariantTypeOf<T>::value != VariantType::Other>;
+
+    if (const T * values = this->ptr()) {
+        return convertToVariant(*values, IsBuiltIn());
+    }
+
+    return convertToVariant(this->value(), IsBuiltIn());
+}
+
+template <typename T, typename ET, typename BASE>
+bool TypedVector<T, ET, BASE>::fromVariant(const Variant & value)
+{
+    if (!value.hasType<T>() && !value.isVariantArray() && !value.isPackedArray()) {
+        return false;
+    }
+
+    this->setValue(value.toVector<ET>());
+    return true;
+}
+
+template <typename T, typename ET, typename BASE>
+std::string TypedVector<T, ET, BASE>::toString() const
+{
+    std::string str = "(";
+
+    // Get the vector only once, as each call of value() may copy it
+    T copy;
+    const T & values = this->readValue(copy);
+
+    for (size_t i=0; i<values.size(); i++) {
+        if (i > 0) str += ", ";
+        str += DirectValue<ET>(values[i]).toString();
+    }
+
+    str += ")";
+
+    return str;
+}
+
+template <typename T, typename ET, typename BASE>
+bool TypedVector<T, ET, BASE>::fromString(const std::string & value)
+{
+    // Find enclosing parentheses
+    size_t begin     = value.find_first_not_of(" \t\r\n");
+    const size_t end = value.find_last_not_of(" \t\r\n");
+
+    if (begin == std::string::npos || value[begin] != '(' || value[end] != ')' || begin == end) {
+        return false;
+    }
+
+    begin++;
+
+    T values;
+    DirectValue<ET> element;
+
+    // Parse elements first, so the vector is either updated at once or not at all
+    const bool empty = value.find_first_not_of(" \t\r\n", begin) == end;
+
+    while (!empty && begin <= end)
+    {
+        size_t separator = value.find(',', begin);
+        if (separator == std::string::npos || separator > end) {
+            separator = end;
+        }
+
+        const size_t first = value.find_first_not_of(" \t\r\n", begin);
+        if (first >= separator) {
+            return false;
+        }
+
+        const size_t last = value.find_last_not_of(" \t\r\n", separator - 1);
+        if (!element.fromString(value.substr(first, last - first + 1))) {
+            return false;
+        }
+
+        values.push_back(element.value());
+        begin = separator + 1;
+    }
+
+    this->setValue(values);
+
+    return true;
+}
+
+template <typename T, typename ET, typename BASE>
+size_t TypedVector<T, ET, BASE>::clipRange(size_t size, size_t first, size_t count)
+{
+    if (first >= size) {
+        return 0;
+    }
+
+    return (count < size - first) ? count : size - first;
+}
+
+template <typename T, typename ET, typename BASE>
+Variant TypedVector<T, ET, BASE>::convertToVariant(const T & value, std::true_type) const
+{
+    return Variant::fromValue<T>(value);
+}
+
+template <typename T, typename ET, typename BASE>
+Variant TypedVector<T, ET, BASE>::convertToVariant(const T & value, std::false_type) const
+{
+    return Variant::fromVector<ET>(value);
+}
+
+
+} // namespace cppexpose
@@ -3,6 +3,7 @@
 
 
 #include <cppexpose/typed/TypeInterface.h>
+#include <cppexpose/typed/TypeDescriptor.h>
 #include <cppexpose/typed/AbstractTyped.hh>
 #include <cppexpose/typed/GetTyped.hh>
 #include <cppexpose/typed/Typed.hh>
@@ -10,6 +11,8 @@
 #include <cppexpose/typed/TypedNumber.hh>
 #include <cppexpose/typed/TypedSignedIntegral.hh>
 #include <cppexpose/typed/TypedArray.hh>
+#include <cppexpose/typed/ArrayElement.hh>
+#include <cppexpose/typed/TypedVector.hh>
 #include <cppexpose/typed/TypedBool.hh>
 #include <cppexpose/typed/TypedEnum.hh>
 #include <cppexpose/typed/TypedFloatingPoint.hh>
@@ -20,6 +23,7 @@
 #include <cppexpose/typed/DirectValue.hh>
 #include <cppexpose/typed/DirectValueSingle.hh>
 #include <cppexpose/typed/DirectValueArray.hh>
+#include <cppexpose/typed/DirectValueVector.hh>
 #include <cppexpose/typed/StoredValue.hh>
 #include <cppexpose/typed/StoredValueSingle.hh>
 #include <cppexpose/typed/StoredValueArray.hh>
@@ -31,6 +35,8 @@
 #include <cppexpose/typed/TypedGeneric.inl>
 #include <cppexpose/typed/TypedNumber.inl>
 #include <cppexpose/typed/TypedArray.inl>
+#include <cppexpose/typed/ArrayElement.inl>
+#include <cppexpose/typed/TypedVector.inl>
 #include <cppexpose/typed/TypedBool.inl>
 #include <cppexpose/typed/TypedEnum.inl>
 #include <cppexpose/typed/TypedFloatingPoint.inl>
@@ -42,6 +48,7 @@
 #include <cppexpose/typed/DirectValue.inl>
 #include <cppexpose/typed/DirectValueSingle.inl>
 #include <cppexpose/typed/DirectValueArray.inl>
+#include <cppexpose/typed/DirectValueVector.inl>
 #include <cppexpose/typed/StoredValue.inl>
 #include <cppexpose/typed/StoredValueSingle.inl>
 #include <cppexpose/typed/StoredValueArray.inl>
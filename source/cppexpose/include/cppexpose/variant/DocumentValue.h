@@ -0,0 +1,317 @@
+
+#pragma once
+
+
+#include <cstdint>
+#include <string>
+
+#include <cppexpose/variant/Variant.h>
+
+
+namespace cppexpose
+{
+
+
+class VariantDocument;
+
+
+/**
+*  @brief
+*    Read-only reference to a value in a variant document
+*
+*    A DocumentValue points directly into the binary data of a VariantDocument.
+*    Nested arrays and maps are accessed lazily: only the values that are visited
+*    are read, nothing is copied or allocated. Strings and packed arrays can be
+*    accessed in place, map entries are found by a binary search over the keys.
+*
+*    Example:
+*    \code{.cpp}
+*        VariantDocument document;
+*        document.load("dataset.bin");
+*
+*        DocumentValue points = document.root().find("points");
+*        const float * data = points.data<float>();
+*        for (size_t i = 0; i < points.size(); ++i) ...
+*    \endcode
+*
+*  @remarks
+*    A DocumentValue must not be used after its document has been closed or destroyed.
+*    Accessing a value that does not exist, or a corrupted part of the document,
+*    results in an empty (null) value.
+*/
+class CPPEXPOSE_API DocumentValue
+{
+    friend class VariantDocument;
+
+
+public:
+    /**
+    *  @brief
+    *    Constructor (empty value)
+    */
+    DocumentValue();
+
+    /**
+    *  @brief
+    *    Check if value is empty
+    *
+    *  @return
+    *    'true' if value is empty, else 'false'
+    */
+    bool isNull() const;
+
+    /**
+    *  @brief
+    *    Get type of the value
+    *
+    *  @return
+    *    Variant type tag (VariantType::Null for empty values)
+    */
+    VariantType variantType() const;
+
+    /**
+    *  @brief
+    *    Check if value is a variant array
+    *
+    *  @return
+    *    'true' if value is a variant array, else 'false'
+    */
+    bool isVariantArray() const;
+
+    /**
+    *  @brief
+    *    Check if value is a variant map
+    *
+    *  @return
+    *    'true' if value is a variant map, else 'false'
+    */
+    bool isVariantMap() const;
+
+    /**
+    *  @brief
+    *    Check if value is a packed numeric array
+    *
+    *  @return
+    *    'true' if value is a packed array, else 'false'
+    */
+    bool isPackedArray() const;
+
+    /**
+    *  @brief
+    *    Check if value is a string
+    *
+    *  @return
+    *    'true' if value is a string, else 'false'
+    */
+    bool isString() const;
+
+    /**
+    *  @brief
+    *    Get size of the value
+    *
+    *  @return
+    *    Number of elements of arrays and maps, length of strings, 0 for all other values
+    */
+    size_t size() const;
+
+    /**
+    *  @brief
+    *    Get element of an array, string vector or map
+    *
+    *  @param[in] index
+    *    Index of the element (for maps in the order of their keys)
+    *
+    *  @return
+    *    Element, empty value if the index is invalid
+    */
+    DocumentValue at(size_t index) const;
+
+    /**
+    *  @brief
+    *    Get key of a map entry
+    *
+    *  @param[in] index
+    *    Index of the entry
+    *
+    *  @return
+    *    Key, empty value if the index is invalid
+    */
+    DocumentValue keyAt(size_t index) const;
+
+    //@{
+    /**
+    *  @brief
+    *    Get value of a map entry
+    *
+    *  @param[in] key
+    *    Key
+    *  @param[in] length
+    *    Length of the key
+    *
+    *  @return
+    *    Value, empty value if the key does not exist
+    */
+    DocumentValue find(const std::string & key) const;
+    DocumentValue find(const char * key) const;
+    DocumentValue find(const char * key, size_t length) const;
+    //@}
+
+    /**
+    *  @brief
+    *    Get characters of a string
+    *
+    *  @return
+    *    Null-terminated string in the document, nullptr if value is not a string
+    */
+    const char * c_str() const;
+
+    /**
+    *  @brief
+    *    Get data of a packed numeric array
+    *
+    *  @return
+    *    Pointer to the first element in the document, nullptr if value is not a packed array of type T
+    */
+    template <typename T>
+    const T * data() const;
+
+    /**
+    *  @brief
+    *    Convert value into bool
+    *
+    *  @return
+    *    Value (converted like Variant::toBool())
+    */
+    bool toBool() const;
+
+    /**
+    *  @brief
+    *    Convert value into long long
+    *
+    *  @return
+    *    Value (converted like Variant::toLongLong())
+    */
+    long long toLongLong() const;
+
+    /**
+    *  @brief
+    *    Convert value into unsigned long long
+    *
+    *  @return
+    *    Value (converted like Variant::toULongLong())
+    */
+    unsigned long long toULongLong() const;
+
+    /**
+    *  @brief
+    *    Convert value into double
+    *
+    *  @return
+    *    Value (converted like Variant::toDouble())
+    */
+    double toDouble() const;
+
+    /**
+    *  @brief
+    *    Convert value into string
+    *
+    *  @return
+    *    Value (converted like Variant::toString())
+    */
+    std::string toString() const;
+
+    /**
+    *  @brief
+    *    Copy value into a variant
+    *
+    *  @return
+    *    Variant that contains a copy of the value and all nested values
+    *
+    *  @remarks
+    *    If arrays and maps are nested deeper than 512 levels, or the nested values
+    *    would contain more data than the document (because a corrupted document
+    *    references the same values multiple times), a null variant is returned.
+    */
+    Variant toVariant() const;
+
+
+protected:
+    /**
+    *  @brief
+    *    Constructor
+    *
+    *  @param[in] data
+    *    Pointer to the document data
+    *  @param[in] size
+    *    Size of the document (in bytes)
+    *  @param[in] offset
+    *    Offset of the value in the document
+    *
+    *  @remarks
+    *    If the offset does not point to a valid value, an empty value is created.
+    */
+    DocumentValue(const std::uint8_t * data, std::uint64_t size, std::uint64_t offset);
+
+    /**
+    *  @brief
+    *    Get the value at an offset that is stored in the document
+    *
+    *  @param[in] position
+    *    Offset of the stored offset
+    *
+    *  @return
+    *    Referenced value
+    */
+    DocumentValue valueAt(std::uint64_t position) const;
+
+    /**
+    *  @brief
+    *    Copy value into a variant
+    *
+    *  @param[out] value
+    *    Variant that receives the value and all nested values
+    *  @param[in] depth
+    *    Nesting depth of the value
+    *  @param[in,out] budget
+    *    Number of bytes that may still be copied
+    *
+    *  @return
+    *    'true' if the value has been copied, 'false' if a limit has been exceeded
+    */
+    bool copyTo(Variant & value, unsigned int depth, std::uint64_t & budget) const;
+
+    /**
+    *  @brief
+    *    Subtract the stored size of the value from a budget
+    *
+    *  @param[in,out] budget
+    *    Number of bytes that may still be copied
+    *
+    *  @return
+    *    'true' if the budget was sufficient, else 'false'
+    */
+    bool consume(std::uint64_t & budget) const;
+
+    /**
+    *  @brief
+    *    Get pointer to the data that follows the value header
+    *
+    *  @return
+    *    Pointer to data
+    */
+    const std::uint8_t * content() const;
+
+
+protected:
+    const std::uint8_t * m_data;    ///< Pointer to the document data (nullptr for empty values)
+    std::uint64_t        m_size;    ///< Size of the document (in bytes)
+    std::uint64_t        m_offset;  ///< Offset of the value in the document
+    std::uint64_t        m_payload; ///< Scalar value, length or number of elements
+    VariantType          m_type;    ///< Type of the value
+};
+
+
+} // namespace cppexpose
+
+
+#include <cppexpose/variant/DocumentValue.inl>
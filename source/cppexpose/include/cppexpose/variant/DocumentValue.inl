@@ -0,0 +1,20 @@
+
+#pragma once
+
+
+namespace cppexpose
+{
+
+
+template <typename T>
+const T * DocumentValue::data() const
+{
+    if (!isPackedArray() || m_type != VariantTypeOf<std::vector<T>>::value) {
+        return nullptr;
+    }
+
+    return reinterpret_cast<const T *>(content());
+}
+
+
+} // namespace cppexpose
@@ -4,8 +4,15 @@
 
 #include <vector>
 #include <map>
+#include <atomic>
 #include <string>
+#include <cstdint>
+#include <type_traits>
+#include <functional>
 
+#include <cppexpose/cppexpose_features.h>
+
+#include <cppexpose/base/FlatMap.h>
 #include <cppexpose/json/JSON.h>
 #include <cppexpose/typed/TypeInterface.h>
 
@@ -21,6 +28,9 @@ class Object;
 template <typename T, typename BASE>
 class Typed;
 
+template <typename T, typename BASE>
+class DirectValue;
+
 
 /**
 *  @brief
@@ -31,8 +41,86 @@ using VariantArray = std::vector<Variant>;
 /**
 *  @brief
 *    Variant map (analog to a JSON object)
+*
+*  @remarks
+*    If cppexpose is built with OPTION_FLAT_VARIANT_MAP, a FlatMap is used instead
+*    of a std::map. Both are iterated in the same (sorted) order.
 */
+#ifdef CPPEXPOSE_FLAT_VARIANT_MAP
+using VariantMap = FlatMap<std::string, Variant>;
+#else
 using VariantMap = std::map<std::string, Variant>;
+#endif
+
+/**
+*  @brief
+*    Type of the value stored in a variant
+*
+*    All built-in types of a variant are identified by this tag, so checking
+*    for these types does not require to compare type ids. All other types
+*    are tagged as Other and must be distinguished by Variant::type().
+*/
+enum class VariantType : unsigned char
+{
+    Null = 0,           ///< Empty variant
+    Bool,               ///< bool
+    Char,               ///< char
+    UnsignedChar,       ///< unsigned char
+    Short,              ///< short
+    UnsignedShort,      ///< unsigned short
+    Int,                ///< int
+    UnsignedInt,        ///< unsigned int
+    Long,               ///< long
+    UnsignedLong,       ///< unsigned long
+    LongLong,           ///< long long
+    UnsignedLongLong,   ///< unsigned long long
+    Float,              ///< float
+    Double,             ///< double
+    String,             ///< std::string
+    StringVector,       ///< std::vector<std::string>
+    VariantArray,       ///< VariantArray
+    VariantMap,         ///< VariantMap
+    ObjectPointer,      ///< Object *
+    ConstObjectPointer, ///< const Object *
+    FloatVector,        ///< std::vector<float> (packed numeric array)
+    DoubleVector,       ///< std::vector<double> (packed numeric array)
+    Int32Vector,        ///< std::vector<std::int32_t> (packed numeric array)
+    Int64Vector,        ///< std::vector<std::int64_t> (packed numeric array)
+    UInt8Vector,        ///< std::vector<std::uint8_t> (packed numeric array)
+    Other               ///< Any other type
+};
+
+/**
+*  @brief
+*    Get variant type tag of a C++ type (VariantType::Other if the type has no tag)
+*/
+template <typename T>
+struct VariantTypeOf : public std::integral_constant<VariantType, VariantType::Other> {};
+
+template <> struct VariantTypeOf<bool>                     : public std::integral_constant<VariantType, VariantType::Bool> {};
+template <> struct VariantTypeOf<char>                     : public std::integral_constant<VariantType, VariantType::Char> {};
+template <> struct VariantTypeOf<unsigned char>            : public std::integral_constant<VariantType, VariantType::UnsignedChar> {};
+template <> struct VariantTypeOf<short>                    : public std::integral_constant<VariantType, VariantType::Short> {};
+template <> struct VariantTypeOf<unsigned short>           : public std::integral_constant<VariantType, VariantType::UnsignedShort> {};
+template <> struct VariantTypeOf<int>                      : public std::integral_constant<VariantType, VariantType::Int> {};
+template <> struct VariantTypeOf<unsigned int>             : public std::integral_constant<VariantType, VariantType::UnsignedInt> {};
+template <> struct VariantTypeOf<long>                     : public std::integral_constant<VariantType, VariantType::Long> {};
+template <> struct VariantTypeOf<unsigned long>            : public std::integral_constant<VariantType, VariantType::UnsignedLong> {};
+template <> struct VariantTypeOf<long long>                : public std::integral_constant<VariantType, VariantType::LongLong> {};
+template <> struct VariantTypeOf<unsigned long long>       : public std::integral_constant<VariantType, VariantType::UnsignedLongLong> {};
+template <> struct VariantTypeOf<float>                    : public std::integral_constant<VariantType, VariantType::Float> {};
+template <> struct VariantTypeOf<double>                   : public std::integral_constant<VariantType, VariantType::Double> {};
+template <> struct VariantTypeOf<std::string>              : public std::integral_constant<VariantType, VariantType::String> {};
+template <> struct VariantTypeOf<std::vector<std::string>> : public std::integral_constant<VariantType, VariantType::StringVector> {};
+template <> struct VariantTypeOf<VariantArray>             : public std::integral_constant<VariantType, VariantType::VariantArray> {};
+template <> struct VariantTypeOf<VariantMap>               : public std::integral_constant<VariantType, VariantType::VariantMap> {};
+template <> struct VariantTypeOf<Object *>                 : public std::integral_constant<VariantType, VariantType::ObjectPointer> {};
+template <> struct VariantTypeOf<const Object *>           : public std::integral_constant<VariantType, VariantType::ConstObjectPointer> {};
+template <> struct VariantTypeOf<std::vector<float>>        : public std::integral_constant<VariantType, VariantType::FloatVector> {};
+template <> struct VariantTypeOf<std::vector<double>>       : public std::integral_constant<VariantType, VariantType::DoubleVector> {};
+template <> struct VariantTypeOf<std::vector<std::int32_t>> : public std::integral_constant<VariantType, VariantType::Int32Vector> {};
+template <> struct VariantTypeOf<std::vector<std::int64_t>> : public std::integral_constant<VariantType, VariantType::Int64Vector> {};
+template <> struct VariantTypeOf<std::vector<std::uint8_t>> : public std::integral_constant<VariantType, VariantType::UInt8Vector> {};
 
 
 /**
@@ -55,6 +143,22 @@ using VariantMap = std::map<std::string, Variant>;
 *    and asArray() or asMap() to access their data. These composite variants will automatically
 *    be interpreted as JSON arrays or objects within scripting and can be serialized by the
 *    JSON tool class.
+*
+*    Large numeric arrays can be stored as packed arrays, i.e., as a std::vector of float,
+*    double, std::int32_t, std::int64_t or std::uint8_t. The numbers are stored contiguously
+*    instead of in individual variants. Packed arrays are serialized as JSON arrays, passed
+*    to scripting as typed arrays and can be read with toVector() or ptr().
+*
+*    Values of primitive data types (numbers, pointers and strings) are stored inline
+*    in the variant itself, so creating or copying such a variant does not allocate
+*    memory on the heap. All other types are stored in a typed value on the heap.
+*
+*    Variant arrays and maps can be switched to a shared representation by calling
+*    share(). Copies of a shared variant reference the same data, which is only
+*    copied when one of the variants is about to be modified (copy-on-write).
+*
+*    Variants can be compared structurally with operator== and hashed with hash(),
+*    e.g., to detect changes in large trees or to use variants as keys in hash maps.
 */
 class CPPEXPOSE_API Variant : public TypeInterface
 {
@@ -82,6 +186,10 @@ public:
     *
     *  @return
     *    Variant array instance
+    *
+    *  @remarks
+    *    Each value is stored in its own variant. To store numbers in a packed
+    *    array instead, use the constructors for numeric vectors.
     */
     template <typename T>
     static Variant fromVector(const std::vector<T> & values);
@@ -126,6 +234,15 @@ public:
     *    Variant whose value will be copied
     */
     Variant(const Variant & variant);
+
+    /**
+    *  @brief
+    *    Move constructor
+    *
+    *  @param[in] variant
+    *    Variant whose value will be moved (is empty afterwards)
+    */
+    Variant(Variant && variant) CPPEXPOSE_NOEXCEPT;
     //@}
 
     /**
@@ -158,6 +275,39 @@ public:
     Variant(Object * obj);
     //@}
 
+    /**
+    *  @brief
+    *    Constructor for a string or composite value that is moved into the variant
+    *
+    *  @param[in] value
+    *    Value (is moved into the variant)
+    */
+    //@{
+    Variant(std::string && value);
+    Variant(VariantArray && array);
+    Variant(VariantMap && map);
+    //@}
+
+    /**
+    *  @brief
+    *    Constructor for a packed numeric array
+    *
+    *  @param[in] values
+    *    Numbers (copied or moved into the variant)
+    */
+    //@{
+    Variant(const std::vector<float> & values);
+    Variant(const std::vector<double> & values);
+    Variant(const std::vector<std::int32_t> & values);
+    Variant(const std::vector<std::int64_t> & values);
+    Variant(const std::vector<std::uint8_t> & values);
+    Variant(std::vector<float> && values);
+    Variant(std::vector<double> && values);
+    Variant(std::vector<std::int32_t> && values);
+    Variant(std::vector<std::int64_t> && values);
+    Variant(std::vector<std::uint8_t> && values);
+    //@}
+
     //@{
     /**
     *  @brief
@@ -178,6 +328,41 @@ public:
     */
     Variant & operator=(const Variant & variant);
 
+    /**
+    *  @brief
+    *    Move operator
+    *
+    *  @param[in] variant
+    *    Variant whose value will be moved (is empty afterwards)
+    *
+    *  @return
+    *    Variant
+    */
+    Variant & operator=(Variant && variant) CPPEXPOSE_NOEXCEPT;
+
+    //@{
+    /**
+    *  @brief
+    *    Compare variants structurally
+    *
+    *  @param[in] variant
+    *    Variant to compare with
+    *
+    *  @return
+    *    Result of the comparison
+    *
+    *  @remarks
+    *    Variants are equal if they have the same type and equal values. Arrays
+    *    and maps are compared element-wise, so 1 and 1.0 or a packed array and
+    *    a variant array with the same numbers are not equal. Values of other
+    *    types are equal if they have the same type and string representation.
+    *    Unlike for built-in floating point comparisons, NaN is equal to NaN, so
+    *    that each variant is equal to its copies and hash() stays consistent.
+    */
+    bool operator==(const Variant & variant) const;
+    bool operator!=(const Variant & variant) const;
+    //@}
+
     /**
     *  @brief
     *    Check if variant is empty
@@ -205,6 +390,15 @@ public:
     */
     bool isVariantMap() const;
 
+    /**
+    *  @brief
+    *    Check if variant is a packed numeric array
+    *
+    *  @return
+    *    'true' if variant contains a std::vector of float, double, std::int32_t, std::int64_t or std::uint8_t, else 'false'
+    */
+    bool isPackedArray() const;
+
     /**
     *  @brief
     *    Get type of variant value
@@ -214,6 +408,15 @@ public:
     */
     const std::type_info & type() const;
 
+    /**
+    *  @brief
+    *    Get type tag of variant value
+    *
+    *  @return
+    *    Type tag (VariantType::Other if the type is not one of the built-in types)
+    */
+    VariantType variantType() const;
+
     /**
     *  @brief
     *    Check type of variant value
@@ -297,6 +500,50 @@ public:
     const VariantMap * asMap() const;
     //@}
 
+    /**
+    *  @brief
+    *    Switch variant array or map to shared storage
+    *
+    *  @remarks
+    *    Copies of a shared variant are created in constant time and share the
+    *    stored data. Before the data is modified (e.g., by calling the non-const
+    *    versions of ptr(), asArray() or asMap()), the variant automatically
+    *    detaches by creating its own copy of the data, if it is still shared
+    *    with other variants. Copies of a shared variant are shared as well.
+    *
+    *    The hash value of shared data is cached (see hash()). The cache is reset on
+    *    every non-const access, so pointers that have been obtained before must not
+    *    be used to modify the data after hash() has been called.
+    *
+    *    Variants of other types are not affected by this function.
+    */
+    void share();
+
+    /**
+    *  @brief
+    *    Check if variant uses shared storage
+    *
+    *  @return
+    *    'true' if share() has been called on the variant or one of the variants it has been copied from, else 'false'
+    */
+    bool isShared() const;
+
+    /**
+    *  @brief
+    *    Get hash value
+    *
+    *  @return
+    *    64 bit hash value, equal variants have equal hash values
+    *
+    *  @remarks
+    *    The hash value is computed from the type and structure of the value
+    *    and does not depend on the platform or on memory addresses (except
+    *    for object pointers and values of other types). For shared arrays and
+    *    maps (see share()), the hash value is cached and only recomputed after
+    *    the data has been modified.
+    */
+    std::uint64_t hash() const;
+
     //@{
     /**
     *  @brief
@@ -318,11 +565,13 @@ public:
     *  @brief
     *    Create a std::vector from a variant array containing arbitrary values
     *
-    *  @param[in] value
-    *    Variant array of value
-    *
     *  @return
-    *    std::vector instance (empty instance if Variant is not a VariantArray)
+    *    std::vector instance (empty instance if Variant is neither a VariantArray nor a packed array)
+    *
+    *  @remarks
+    *    If the variant is a packed array of the requested type, the numbers are
+    *    copied as a whole. Packed arrays of other types are converted element-wise
+    *    into arithmetic types.
     */
     template <typename T>
     std::vector<T> toVector() const;
@@ -353,8 +602,212 @@ public:
 
 
 protected:
-    std::unique_ptr<AbstractTyped> m_value;
+    /**
+    *  @brief
+    *    Storage for values that are stored inline (large enough for a DirectValue<std::string>)
+    */
+    typedef std::aligned_storage<sizeof(void *) + sizeof(std::string), std::alignment_of<long long>::value>::type InlineStorage;
+
+    /**
+    *  @brief
+    *    Functions to manage values that are not exclusively owned on the heap
+    */
+    struct ValueFunctions
+    {
+        void            (*copy)(Variant & target, const Variant & source); ///< Copy value into empty target variant
+        void            (*move)(Variant & target, Variant & source);       ///< Move value into empty target variant (null if the pointer can be taken over)
+        void            (*destroy)(AbstractTyped * value);                 ///< Destroy value
+        AbstractTyped * (*detach)(AbstractTyped * value);                  ///< Get exclusively owned version of a shared value (null if value is not shared)
+    };
+
+    /**
+    *  @brief
+    *    Implementation of the value functions for an inline value of type T
+    */
+    template <typename T>
+    struct InlineValue
+    {
+        static void copy(Variant & target, const Variant & source);
+        static void move(Variant & target, Variant & source);
+        static void destroy(AbstractTyped * value);
+
+        static const ValueFunctions functions;
+    };
+
+    /**
+    *  @brief
+    *    Implementation of the value functions for a shared value of type T
+    */
+    template <typename T>
+    struct SharedValue;
+
+    /**
+    *  @brief
+    *    Check if a value of type T is stored inline
+    */
+    template <typename T>
+    struct IsInline : public std::integral_constant<bool,
+        (std::is_arithmetic<T>::value || std::is_pointer<T>::value || std::is_same<T, std::string>::value) &&
+        !std::is_const<T>::value &&
+        sizeof(DirectValue<T, AbstractTyped>) <= sizeof(InlineStorage) &&
+        std::alignment_of<DirectValue<T, AbstractTyped>>::value <= std::alignment_of<InlineStorage>::value>
+    {
+    };
+
+
+protected:
+    /**
+    *  @brief
+    *    Check if the variant stores a bool, number or string
+    *
+    *  @return
+    *    'true' if the value has a built-in scalar type, else 'false'
+    */
+    bool isScalar() const;
+
+    /**
+    *  @brief
+    *    Get stored value of a built-in type
+    *
+    *  @return
+    *    Reference to the stored value
+    *
+    *  @remarks
+    *    T must be the stored type. The value is accessed without virtual function calls.
+    */
+    template <typename T>
+    const T & data() const;
+
+    /**
+    *  @brief
+    *    Convert stored scalar value (see isScalar()) into type T
+    *
+    *  @return
+    *    Converted value
+    *
+    *  @remarks
+    *    Only call this function if ConvertScalar<T>::supported is 'true'.
+    */
+    template <typename T>
+    T convertScalar() const;
+
+    /**
+    *  @brief
+    *    Create typed value (stored inline if possible, otherwise on the heap)
+    *
+    *  @param[in] value
+    *    Value (is copied or moved into the typed value)
+    *
+    *  @remarks
+    *    The variant must be empty when calling this function.
+    */
+    template <typename T, typename V>
+    void initValue(V && value);
+
+    //@{
+    /**
+    *  @brief
+    *    Create typed value (helper functions for initValue())
+    */
+    template <typename T, typename V>
+    void initValue(V && value, std::true_type inlineStorage);
+    template <typename T, typename V>
+    void initValue(V && value, std::false_type inlineStorage);
+    //@}
+
+    //@{
+    /**
+    *  @brief
+    *    Convert packed array into a std::vector (helper functions for toVector())
+    */
+    template <typename T>
+    std::vector<T> packedToVector(std::true_type isArithmetic) const;
+    template <typename T>
+    std::vector<T> packedToVector(std::false_type isArithmetic) const;
+    //@}
+
+    /**
+    *  @brief
+    *    Copy value from another variant
+    *
+    *  @param[in] variant
+    *    Variant whose value will be copied
+    *
+    *  @remarks
+    *    The variant must be empty when calling this function.
+    */
+    void copyValue(const Variant & variant);
+
+    /**
+    *  @brief
+    *    Move value from another variant
+    *
+    *  @param[in] variant
+    *    Variant whose value will be moved (is empty afterwards)
+    *
+    *  @remarks
+    *    The variant must be empty when calling this function.
+    */
+    void moveValue(Variant & variant) CPPEXPOSE_NOEXCEPT;
+
+    /**
+    *  @brief
+    *    Destroy the stored value and make the variant empty
+    */
+    void destroyValue() CPPEXPOSE_NOEXCEPT;
+
+    /**
+    *  @brief
+    *    Make sure that the stored value is not shared with other variants
+    */
+    void detach();
+
+    /**
+    *  @brief
+    *    Get cached hash value of shared data
+    *
+    *  @return
+    *    Cache (0 if no hash value has been cached), nullptr if the data is not shared
+    */
+    std::atomic<std::uint64_t> * hashCache() const;
+
+    /**
+    *  @brief
+    *    Compute hash value of the stored value
+    *
+    *  @return
+    *    Hash value
+    */
+    std::uint64_t computeHash() const;
+
+
+protected:
+    AbstractTyped        * m_value;     ///< Typed value (points into m_storage for inline values, can be null)
+    const ValueFunctions * m_functions; ///< Functions to manage the value (null if the value is exclusively owned on the heap)
+    VariantType            m_type;      ///< Type tag of the value
+    InlineStorage          m_storage;   ///< Storage for inline values
 };
 
 
 } // namespace cppexpose
+
+
+namespace std
+{
+
+
+/**
+*  @brief
+*    Hash function for variants
+*/
+template <>
+struct hash<cppexpose::Variant>
+{
+    size_t operator()(const cppexpose::Variant & variant) const
+    {
+        return static_cast<size_t>(variant.hash());
+    }
+};
+
+
+} // namespace std
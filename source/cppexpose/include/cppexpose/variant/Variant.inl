@@ -2,8 +2,11 @@
 #pragma once
 
 
+#include <new>
 #include <typeinfo>
+#include <utility>
 
+#include <cppexpose/base/number_helpers.h>
 #include <cppexpose/base/template_helpers.h>
 #include <cppexpose/typed/DirectValue.hh>
 
@@ -26,6 +29,181 @@ struct ConvertVariant
     }
 };
 
+/**
+*  @brief
+*    Conversion of built-in scalar values (bool, numbers and strings) into type T
+*
+*    The conversions yield the same results as the conversions of the typed values
+*    (see ConvertTyped), but are resolved at compile time for each pair of types.
+*/
+template <typename T, typename Enable = void>
+struct ConvertScalar
+{
+    static const bool supported = false;
+
+    template <typename S>
+    static T convertTo(const S &)
+    {
+        return T();
+    }
+
+    static T parse(const std::string &)
+    {
+        return T();
+    }
+};
+
+template <>
+struct ConvertScalar<bool>
+{
+    static const bool supported = true;
+
+    template <typename S>
+    static bool convertTo(const S & value)
+    {
+        return static_cast<bool>(value);
+    }
+
+    static bool parse(const std::string & value)
+    {
+        return value == "true";
+    }
+};
+
+template <typename T>
+struct ConvertScalar<T, helper::EnableIf<helper::isSignedIntegral<T>>>
+{
+    static const bool supported = true;
+
+    template <typename S>
+    static T convertTo(const S & value)
+    {
+        return static_cast<T>(static_cast<long long>(value));
+    }
+
+    static T parse(const std::string & value)
+    {
+        // Characters are read as characters, like in string streams
+        if (helper::isCharacter<T>::value) {
+            return static_cast<T>(helper::parseCharacter(value));
+        }
+
+        return static_cast<T>(helper::parseInteger(value));
+    }
+};
+
+template <typename T>
+struct ConvertScalar<T, helper::EnableIf<helper::isUnsignedIntegral<T>>>
+{
+    static const bool supported = true;
+
+    template <typename S>
+    static T convertTo(const S & value)
+    {
+        return static_cast<T>(static_cast<unsigned long long>(value));
+    }
+
+    static T parse(const std::string & value)
+    {
+        // Characters are read as characters, like in string streams
+        if (helper::isCharacter<T>::value) {
+            return static_cast<T>(helper::parseCharacter(value));
+        }
+
+        return static_cast<T>(helper::parseUnsignedInteger(value));
+    }
+};
+
+template <typename T>
+struct ConvertScalar<T, helper::EnableIf<helper::isFloatingPoint<T>>>
+{
+    static const bool supported = true;
+
+    template <typename S>
+    static T convertTo(const S & value)
+    {
+        return static_cast<T>(static_cast<double>(value));
+    }
+
+    static T parse(const std::string & value)
+    {
+        return static_cast<T>(helper::parseFloatingPoint(value));
+    }
+};
+
+template <>
+struct ConvertScalar<std::string>
+{
+    static const bool supported = true;
+
+    static std::string convertTo(const bool & value)
+    {
+        return value ? "true" : "false";
+    }
+
+    // Characters are output as characters, like in string streams
+    static std::string convertTo(const char & value)
+    {
+        return std::string(1, value);
+    }
+
+    static std::string convertTo(const signed char & value)
+    {
+        return std::string(1, static_cast<char>(value));
+    }
+
+    static std::string convertTo(const unsigned char & value)
+    {
+        return std::string(1, static_cast<char>(value));
+    }
+
+    template <typename S>
+    static std::string convertTo(const S & value)
+    {
+        return format(value, typename std::is_floating_point<S>::type(), typename std::is_signed<S>::type());
+    }
+
+    template <typename S, typename IsSigned>
+    static std::string format(const S & value, std::true_type, IsSigned)
+    {
+        // Use the fewest digits that round-trip, in the precision of S (like TypedFloatingPoint)
+        using Precision = typename std::conditional<std::is_same<S, float>::value, float, double>::type;
+
+        return helper::formatShortestFloatingPoint(static_cast<Precision>(value));
+    }
+
+    template <typename S>
+    static std::string format(const S & value, std::false_type, std::true_type)
+    {
+        return helper::formatInteger(static_cast<long long>(value));
+    }
+
+    template <typename S>
+    static std::string format(const S & value, std::false_type, std::false_type)
+    {
+        return helper::formatUnsignedInteger(static_cast<unsigned long long>(value));
+    }
+
+    static std::string parse(const std::string & value)
+    {
+        return value;
+    }
+};
+
+template <typename T, typename E>
+std::vector<T> convertPackedVector(const std::vector<E> & values)
+{
+    std::vector<T> vector;
+    vector.reserve(values.size());
+
+    for (const auto & value : values)
+    {
+        vector.push_back(static_cast<T>(value));
+    }
+
+    return vector;
+}
+
 template <>
 struct ConvertVariant<std::string>
 {
@@ -45,7 +223,7 @@ template <typename T>
 Variant Variant::fromValue(const T & value)
 {
     Variant variant;
-    variant.m_value = cppassist::make_unique<DirectValue<T>>(value);
+    variant.initValue<T>(value);
     return variant;
 }
 
@@ -64,6 +242,16 @@ Variant Variant::fromVector(const std::vector<T> & values)
 template <typename T>
 std::vector<T> Variant::toVector() const
 {
+    // Packed array of the requested type
+    if (hasType<std::vector<T>>()) {
+        return *static_cast<const DirectValue<std::vector<T>> *>(m_value)->ptr();
+    }
+
+    // Packed array of another type
+    if (isPackedArray()) {
+        return packedToVector<T>(typename std::is_arithmetic<T>::type());
+    }
+
     std::vector<T> vector;
 
     if (!isVariantArray()) {
@@ -82,17 +270,49 @@ std::vector<T> Variant::toVector() const
 template <typename T>
 bool Variant::hasType() const
 {
-    if (!m_value) {
-        return false;
+    // Built-in types are identified by their type tag
+    if (VariantTypeOf<T>::value != VariantType::Other) {
+        return m_type == VariantTypeOf<T>::value;
     }
 
-    return typeid(T) == m_value->type();
+    return m_type == VariantType::Other && typeid(T) == m_value->type();
+}
+
+template <typename T>
+std::vector<T> Variant::packedToVector(std::true_type) const
+{
+    switch (m_type)
+    {
+        case VariantType::FloatVector:
+            return convertPackedVector<T>(*ptr<std::vector<float>>());
+
+        case VariantType::DoubleVector:
+            return convertPackedVector<T>(*ptr<std::vector<double>>());
+
+        case VariantType::Int32Vector:
+            return convertPackedVector<T>(*ptr<std::vector<std::int32_t>>());
+
+        case VariantType::Int64Vector:
+            return convertPackedVector<T>(*ptr<std::vector<std::int64_t>>());
+
+        case VariantType::UInt8Vector:
+            return convertPackedVector<T>(*ptr<std::vector<std::uint8_t>>());
+
+        default:
+            return std::vector<T>();
+    }
+}
+
+template <typename T>
+std::vector<T> Variant::packedToVector(std::false_type) const
+{
+    return std::vector<T>();
 }
 
 template <typename T>
 bool Variant::canConvert() const
 {
-    if (isVariantMap() || isVariantArray())
+    if (isVariantMap() || isVariantArray() || isPackedArray())
     {
         return ConvertVariant<T>::canConvert();
     }
@@ -108,13 +328,19 @@ template <typename T>
 T Variant::value(const T & defaultValue) const
 {
     // Type of variant is the wanted type
-    if (m_value && typeid(T) == m_value->type())
+    if (hasType<T>())
+    {
+        return static_cast<DirectValue<T> *>(m_value)->value();
+    }
+
+    // Conversion between built-in scalar types
+    else if (ConvertScalar<T>::supported && isScalar())
     {
-        return static_cast<DirectValue<T> *>(m_value.get())->value();
+        return convertScalar<T>();
     }
 
     // Variant map or array to string conversion
-    else if (isVariantMap() || isVariantArray())
+    else if (isVariantMap() || isVariantArray() || isPackedArray())
     {
         return ConvertVariant<T>::convertTo(*this);
     }
@@ -132,8 +358,13 @@ T Variant::value(const T & defaultValue) const
 template <typename T>
 T * Variant::ptr()
 {
-    if (m_value && typeid(T) == m_value->type()) {
-        return static_cast<DirectValue<T> *>(m_value.get())->ptr();
+    if (hasType<T>()) {
+        // Data is about to be modified, so it must not be shared
+        if (m_functions && m_functions->detach) {
+            detach();
+        }
+
+        return static_cast<DirectValue<T> *>(m_value)->ptr();
     } else {
         return nullptr;
     }
@@ -142,12 +373,95 @@ T * Variant::ptr()
 template <typename T>
 const T * Variant::ptr() const
 {
-    if (m_value && typeid(T) == m_value->type()) {
-        return static_cast<const DirectValue<T> *>(m_value.get())->ptr();
+    if (hasType<T>()) {
+        return static_cast<const DirectValue<T> *>(m_value)->ptr();
     } else {
         return nullptr;
     }
 }
 
+template <typename T>
+const T & Variant::data() const
+{
+    // Qualified call avoids the virtual dispatch
+    return *static_cast<const DirectValue<T> *>(m_value)->DirectValue<T>::ptr();
+}
+
+template <typename T>
+T Variant::convertScalar() const
+{
+    switch (m_type)
+    {
+        case VariantType::Bool:             return ConvertScalar<T>::convertTo(data<bool>());
+        case VariantType::Char:             return ConvertScalar<T>::convertTo(data<char>());
+        case VariantType::UnsignedChar:     return ConvertScalar<T>::convertTo(data<unsigned char>());
+        case VariantType::Short:            return ConvertScalar<T>::convertTo(data<short>());
+        case VariantType::UnsignedShort:    return ConvertScalar<T>::convertTo(data<unsigned short>());
+        case VariantType::Int:              return ConvertScalar<T>::convertTo(data<int>());
+        case VariantType::UnsignedInt:      return ConvertScalar<T>::convertTo(data<unsigned int>());
+        case VariantType::Long:             return ConvertScalar<T>::convertTo(data<long>());
+        case VariantType::UnsignedLong:     return ConvertScalar<T>::convertTo(data<unsigned long>());
+        case VariantType::LongLong:         return ConvertScalar<T>::convertTo(data<long long>());
+        case VariantType::UnsignedLongLong: return ConvertScalar<T>::convertTo(data<unsigned long long>());
+        case VariantType::Float:            return ConvertScalar<T>::convertTo(data<float>());
+        case VariantType::Double:           return ConvertScalar<T>::convertTo(data<double>());
+        case VariantType::String:           return ConvertScalar<T>::parse(data<std::string>());
+        default:                            return T();
+    }
+}
+
+template <typename T, typename V>
+void Variant::initValue(V && value)
+{
+    initValue<T>(std::forward<V>(value), typename IsInline<T>::type());
+}
+
+template <typename T, typename V>
+void Variant::initValue(V && value, std::true_type)
+{
+    m_value     = new (&m_storage) DirectValue<T>(std::forward<V>(value));
+    m_functions = &InlineValue<T>::functions;
+    m_type      = VariantTypeOf<T>::value;
+}
+
+template <typename T, typename V>
+void Variant::initValue(V && value, std::false_type)
+{
+    m_value     = new DirectValue<T>(std::forward<V>(value));
+    m_functions = nullptr;
+    m_type      = VariantTypeOf<T>::value;
+}
+
+template <typename T>
+void Variant::InlineValue<T>::copy(Variant & target, const Variant & source)
+{
+    target.m_value     = new (&target.m_storage) DirectValue<T>(*static_cast<const DirectValue<T> *>(source.m_value)->ptr());
+    target.m_functions = source.m_functions;
+    target.m_type      = source.m_type;
+}
+
+template <typename T>
+void Variant::InlineValue<T>::move(Variant & target, Variant & source)
+{
+    target.m_value     = new (&target.m_storage) DirectValue<T>(std::move(*static_cast<DirectValue<T> *>(source.m_value)->ptr()));
+    target.m_functions = source.m_functions;
+    target.m_type      = source.m_type;
+}
+
+template <typename T>
+void Variant::InlineValue<T>::destroy(AbstractTyped * value)
+{
+    value->~AbstractTyped();
+}
+
+template <typename T>
+const Variant::ValueFunctions Variant::InlineValue<T>::functions =
+{
+    &Variant::InlineValue<T>::copy,
+    &Variant::InlineValue<T>::move,
+    &Variant::InlineValue<T>::destroy,
+    nullptr
+};
+
 
 } // namespace cppexpose
@@ -0,0 +1,167 @@
+
+#pragma once
+
+
+#include <cstdint>
+#include <string>
+#include <vector>
+
+#include <cppexpose/variant/DocumentValue.h>
+
+
+namespace cppexpose
+{
+
+
+/**
+*  @brief
+*    Read-only variant tree in a binary document
+*
+*    A variant document stores a variant tree in a binary layout that can be used
+*    directly from memory: values reference each other by offsets instead of pointers,
+*    strings and packed arrays are stored in place, and the keys of maps are sorted.
+*    Loading a document maps the file into memory, so no data is read or copied until
+*    it is accessed (see DocumentValue), and several processes that load the same file
+*    share one copy of it in memory.
+*
+*    Example:
+*    \code{.cpp}
+*        VariantDocument::save(dataset, "dataset.bin");
+*
+*        VariantDocument document;
+*        if (document.load("dataset.bin")) {
+*            std::string name = document.root().find("name").toString();
+*        }
+*    \endcode
+*
+*  @remarks
+*    Documents use the byte order of the machine that has written them and
+*    cannot be opened on a machine with a different byte order.
+*/
+class CPPEXPOSE_API VariantDocument
+{
+public:
+    /**
+    *  @brief
+    *    Encode variant into a document
+    *
+    *  @param[in] root
+    *    Variant value
+    *
+    *  @return
+    *    Document data
+    *
+    *  @remarks
+    *    Object pointers are stored as empty values, other types that are not
+    *    supported by Variant directly are stored as strings (like in JSON).
+    */
+    static std::vector<std::uint8_t> encode(const Variant & root);
+
+    /**
+    *  @brief
+    *    Save variant to document file
+    *
+    *  @param[in] root
+    *    Variant value
+    *  @param[in] filename
+    *    Filename of document
+    *
+    *  @return
+    *    'true' if all went fine, 'false' on error
+    */
+    static bool save(const Variant & root, const std::string & filename);
+
+
+public:
+    /**
+    *  @brief
+    *    Constructor (empty document)
+    */
+    VariantDocument();
+
+    /**
+    *  @brief
+    *    Destructor
+    */
+    ~VariantDocument();
+
+    VariantDocument(const VariantDocument &) = delete;
+    VariantDocument & operator=(const VariantDocument &) = delete;
+
+    /**
+    *  @brief
+    *    Load document from file
+    *
+    *  @param[in] filename
+    *    Filename of document
+    *
+    *  @return
+    *    'true' if all went fine, 'false' on error
+    *
+    *  @remarks
+    *    The file is mapped into memory read-only and must not be modified while it is loaded.
+    */
+    bool load(const std::string & filename);
+
+    /**
+    *  @brief
+    *    Open document from memory
+    *
+    *  @param[in] data
+    *    Pointer to document data (must be aligned to 8 bytes)
+    *  @param[in] size
+    *    Size of document data (in bytes)
+    *
+    *  @return
+    *    'true' if all went fine, 'false' on error
+    *
+    *  @remarks
+    *    The data is not copied, it must stay valid until the document is closed.
+    */
+    bool open(const void * data, size_t size);
+
+    /**
+    *  @brief
+    *    Close document
+    *
+    *  @remarks
+    *    All values of the document become invalid.
+    */
+    void close();
+
+    /**
+    *  @brief
+    *    Check if a document is opened
+    *
+    *  @return
+    *    'true' if document is valid, else 'false'
+    */
+    bool isValid() const;
+
+    /**
+    *  @brief
+    *    Get size of document
+    *
+    *  @return
+    *    Size of document data (in bytes)
+    */
+    size_t size() const;
+
+    /**
+    *  @brief
+    *    Get root value
+    *
+    *  @return
+    *    Root value, empty value if no document is opened
+    */
+    DocumentValue root() const;
+
+
+protected:
+    const std::uint8_t * m_data;   ///< Pointer to document data (nullptr if no document is opened)
+    size_t               m_size;   ///< Size of document data (in bytes)
+    bool                 m_mapped; ///< 'true' if the data has been mapped from a file, else 'false'
+};
+
+
+} // namespace cppexpose
@@ -0,0 +1,189 @@
+
+#pragma once
+
+
+#include <string>
+#include <vector>
+
+#include <cppexpose/variant/Variant.h>
+
+
+namespace cppexpose
+{
+
+
+/**
+*  @brief
+*    List of changes between two variant trees
+*
+*    A patch is created by comparing two variants with diff(). It contains
+*    only the values that have been added, removed or replaced, identified
+*    by their path of keys in nested variant maps. Applying the patch to the
+*    original variant (or an equal one) turns it into the new variant, and only
+*    touches the changed subtrees. Shared subtrees (see Variant::share())
+*    that have not been changed are neither compared in depth nor copied.
+*
+*    Example:
+*    \code{.cpp}
+*        VariantPatch patch = VariantPatch::diff(oldConfig, newConfig);
+*
+*        patch.apply(config);      // Update a variant
+*        object.applyPatch(patch); // Update only the changed properties of an object
+*    \endcode
+*
+*  @remarks
+*    The diff descends into variant maps only. Arrays and all other values
+*    are replaced as a whole if they have been changed.
+*/
+class CPPEXPOSE_API VariantPatch
+{
+public:
+    /**
+    *  @brief
+    *    Type of a change
+    */
+    enum class Operation : unsigned char
+    {
+        Add,     ///< Value has been added to a map
+        Remove,  ///< Value has been removed from a map
+        Replace  ///< Value has been replaced
+    };
+
+    /**
+    *  @brief
+    *    Single change of a value
+    */
+    struct Change
+    {
+        Operation                operation; ///< Type of change
+        std::vector<std::string> path;      ///< Keys of the value in nested maps (empty for the root value)
+        Variant                  value;     ///< New value (empty for Operation::Remove)
+    };
+
+
+public:
+    /**
+    *  @brief
+    *    Compute the changes between two variants
+    *
+    *  @param[in] from
+    *    Original variant
+    *  @param[in] to
+    *    Changed variant
+    *
+    *  @return
+    *    Patch that turns from into to
+    */
+    static VariantPatch diff(const Variant & from, const Variant & to);
+
+    /**
+    *  @brief
+    *    Restore patch from its variant representation
+    *
+    *  @param[in] value
+    *    Variant representation (see toVariant())
+    *
+    *  @return
+    *    Patch, empty if the variant is not a valid representation
+    */
+    static VariantPatch fromVariant(const Variant & value);
+
+    /**
+    *  @brief
+    *    Apply a single change to a variant
+    *
+    *  @param[in] target
+    *    Variant that is modified
+    *  @param[in] change
+    *    Change
+    *  @param[in] depth
+    *    Number of keys at the beginning of the path that are skipped
+    *
+    *  @return
+    *    'true' if the change could be applied, 'false' if its path does not exist
+    */
+    static bool applyChange(Variant & target, const Change & change, size_t depth = 0);
+
+
+public:
+    /**
+    *  @brief
+    *    Constructor (empty patch)
+    */
+    VariantPatch();
+
+    /**
+    *  @brief
+    *    Check if patch is empty
+    *
+    *  @return
+    *    'true' if the patch contains no changes, else 'false'
+    */
+    bool empty() const;
+
+    /**
+    *  @brief
+    *    Get changes
+    *
+    *  @return
+    *    List of changes (in the order in which they are applied)
+    */
+    const std::vector<Change> & changes() const;
+
+    /**
+    *  @brief
+    *    Add change
+    *
+    *  @param[in] operation
+    *    Type of change
+    *  @param[in] path
+    *    Keys of the value in nested maps
+    *  @param[in] value
+    *    New value (ignored for Operation::Remove)
+    */
+    void addChange(Operation operation, const std::vector<std::string> & path, const Variant & value = Variant());
+
+    /**
+    *  @brief
+    *    Apply all changes to a variant
+    *
+    *  @param[in] target
+    *    Variant that is modified
+    *
+    *  @return
+    *    'true' if all changes could be applied, else 'false'
+    */
+    bool apply(Variant & target) const;
+
+    /**
+    *  @brief
+    *    Get variant representation of the patch
+    *
+    *  @return
+    *    Variant array that contains a map for each change, e.g.,
+    *    {"op": "replace", "path": ["window", "width"], "value": 800}
+    */
+    Variant toVariant() const;
+
+
+protected:
+    /**
+    *  @brief
+    *    Compute changes between two variants (helper function for diff())
+    *
+    *  @param[in] from
+    *    Original variant
+    *  @param[in] to
+    *    Changed variant
+    *  @param[in,out] path
+    *    Path of the compared variants (restored on return)
+    */
+    void compare(const Variant & from, const Variant & to, std::vector<std::string> & path);
+
+
+protected:
+    std::vector<Change> m_changes; ///< List of changes
+};
+
+
+} // namespace cppexpose
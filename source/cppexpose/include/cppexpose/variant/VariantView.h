@@ -0,0 +1,369 @@
+
+#pragma once
+
+
+#include <string>
+#include <vector>
+#include <typeinfo>
+
+#include <cppexpose/variant/Variant.h>
+
+
+namespace cppexpose
+{
+
+
+/**
+*  @brief
+*    Non-owning read-only reference to a value
+*
+*    A VariantView can point to an existing Variant, a typed value (e.g., a property),
+*    or a raw scalar value, and provides the same functions to query and convert
+*    the value as Variant. In contrast to a Variant, creating a view never copies
+*    the value, so views can be used to inspect or serialize values and object trees
+*    without creating intermediate variants.
+*
+*    Example:
+*    \code{.cpp}
+*        DynamicProperty<int> prop("value", nullptr, 42);
+*
+*        VariantView view(prop);
+*        int value = view.value<int>();           // Read directly from the property
+*        std::string str = view.value<std::string>();
+*    \endcode
+*
+*  @remarks
+*    A view does not extend the lifetime of the referenced value, so it must not be
+*    used after the value has been destroyed. Views to temporary variants cannot be created.
+*/
+class CPPEXPOSE_API VariantView
+{
+public:
+    /**
+    *  @brief
+    *    Create view to a raw value
+    *
+    *  @param[in] value
+    *    Value (must be a number, bool or std::string)
+    *
+    *  @return
+    *    View to the value
+    */
+    template <typename T>
+    static VariantView fromValue(const T & value);
+
+
+public:
+    /**
+    *  @brief
+    *    Constructor (empty view)
+    */
+    VariantView();
+
+    /**
+    *  @brief
+    *    Constructor
+    *
+    *  @param[in] variant
+    *    Variant that is referenced
+    */
+    VariantView(const Variant & variant);
+
+    /**
+    *  @brief
+    *    Constructor
+    *
+    *  @param[in] value
+    *    Typed value that is referenced
+    */
+    VariantView(const AbstractTyped & value);
+
+    /**
+    *  @brief
+    *    Constructor
+    *
+    *  @param[in] value
+    *    Typed value that is referenced
+    *
+    *  @remarks
+    *    If the typed value provides a pointer to its data, the data is read directly.
+    *    A typed value that holds a Variant is viewed like the variant itself.
+    */
+    template <typename T, typename BASE>
+    VariantView(const Typed<T, BASE> & value);
+
+    // Views to temporary variants would be dangling
+    VariantView(Variant && variant) = delete;
+
+    /**
+    *  @brief
+    *    Check if view is empty or references an empty variant
+    *
+    *  @return
+    *    'true' if the referenced value is null, else 'false'
+    */
+    bool isNull() const;
+
+    /**
+    *  @brief
+    *    Check if the referenced value is a variant array
+    *
+    *  @return
+    *    'true' if value is a variant array, else 'false'
+    */
+    bool isVariantArray() const;
+
+    /**
+    *  @brief
+    *    Check if the referenced value is a variant map
+    *
+    *  @return
+    *    'true' if value is a variant map, else 'false'
+    */
+    bool isVariantMap() const;
+
+    /**
+    *  @brief
+    *    Check if the referenced value is a packed numeric array
+    *
+    *  @return
+    *    'true' if value is a packed array, else 'false'
+    */
+    bool isPackedArray() const;
+
+    /**
+    *  @brief
+    *    Get type of the referenced value
+    *
+    *  @return
+    *    Type of the value (typeid(void) if the view is empty)
+    */
+    const std::type_info & type() const;
+
+    /**
+    *  @brief
+    *    Get type tag of the referenced value
+    *
+    *  @return
+    *    Type tag (VariantType::Other for typed values whose data type is unknown)
+    */
+    VariantType variantType() const;
+
+    /**
+    *  @brief
+    *    Check if the referenced value has the given type
+    *
+    *  @return
+    *    'true' if the value is of type ValueType, else 'false'
+    */
+    template <typename ValueType>
+    bool hasType() const;
+
+    /**
+    *  @brief
+    *    Check if the referenced value can be converted
+    *
+    *  @return
+    *    'true' if the value can be converted into type ValueType, else 'false'
+    *
+    *  @see
+    *    Variant::canConvert()
+    */
+    template <typename ValueType>
+    bool canConvert() const;
+
+    /**
+    *  @brief
+    *    Get referenced value
+    *
+    *  @param[in] defaultValue
+    *    Default value that is returned if the value cannot be returned or converted
+    *
+    *  @return
+    *    Value of type ValueType, or defaultValue if type does not match and cannot be converted
+    */
+    template <typename T>
+    T value(const T & defaultValue = T()) const;
+
+    /**
+    *  @brief
+    *    Get pointer to the referenced data
+    *
+    *  @return
+    *    Pointer to the data, nullptr if the type does not match or the data is not accessible
+    */
+    template <typename ValueType>
+    const ValueType * ptr() const;
+
+    /**
+    *  @brief
+    *    Get pointer to the referenced variant array
+    *
+    *  @return
+    *    Pointer to the array, nullptr if the value is not a variant array
+    */
+    const VariantArray * asArray() const;
+
+    /**
+    *  @brief
+    *    Get pointer to the referenced variant map
+    *
+    *  @return
+    *    Pointer to the map, nullptr if the value is not a variant map
+    */
+    const VariantMap * asMap() const;
+
+    /**
+    *  @brief
+    *    Convert the referenced value into a vector
+    *
+    *  @return
+    *    Vector of values
+    *
+    *  @see
+    *    Variant::toVector()
+    */
+    template <typename T>
+    std::vector<T> toVector() const;
+
+    /**
+    *  @brief
+    *    Get referenced variant
+    *
+    *  @return
+    *    Variant, nullptr if the view does not reference a variant
+    */
+    const Variant * variant() const;
+
+    /**
+    *  @brief
+    *    Get referenced typed value
+    *
+    *  @return
+    *    Typed value, nullptr if the view does not reference a typed value
+    */
+    const AbstractTyped * typed() const;
+
+    /**
+    *  @brief
+    *    Check if the referenced typed value has sub-values (e.g., an object or array)
+    *
+    *  @return
+    *    'true' if value is composite, else 'false'
+    */
+    bool isComposite() const;
+
+    /**
+    *  @brief
+    *    Get number of sub-values of the referenced typed value
+    *
+    *  @return
+    *    Number of sub-values, 0 if not a composite
+    */
+    size_t numSubValues() const;
+
+    /**
+    *  @brief
+    *    Get view to a sub-value of the referenced typed value
+    *
+    *  @param[in] index
+    *    Index of sub-value
+    *
+    *  @return
+    *    View to the sub-value, empty view on error
+    */
+    VariantView subValue(size_t index) const;
+
+    /**
+    *  @brief
+    *    Create a variant containing a copy of the referenced value
+    *
+    *  @return
+    *    Variant
+    */
+    Variant toVariant() const;
+
+    /**
+    *  @brief
+    *    Convert the referenced value into JSON
+    *
+    *  @param[in] outputMode
+    *    JSON output mode
+    *
+    *  @return
+    *    JSON string
+    */
+    std::string toJSON(JSON::OutputMode outputMode = JSON::Compact) const;
+
+    // Read-only part of the TypeInterface interface
+    bool isEnum() const;
+    bool isArray() const;
+    bool isVariant() const;
+    bool isString() const;
+    bool isBool() const;
+    bool isNumber() const;
+    bool isIntegral() const;
+    bool isSignedIntegral() const;
+    bool isUnsignedIntegral() const;
+    bool isFloatingPoint() const;
+    std::string toString() const;
+    bool toBool() const;
+    long long toLongLong() const;
+    unsigned long long toULongLong() const;
+    double toDouble() const;
+
+
+protected:
+    /**
+    *  @brief
+    *    Call visitor with the referenced raw scalar
+    *
+    *  @param[in] visitor
+    *    Function object that can be called with a const reference to each scalar type
+    *  @param[in] defaultValue
+    *    Value that is returned if the view does not reference a raw scalar
+    *
+    *  @return
+    *    Return value of the visitor
+    *
+    *  @remarks
+    *    The visitor receives the referenced data itself, so strings are not copied.
+    */
+    template <typename R, typename Visitor>
+    R visitScalar(const Visitor & visitor, const R & defaultValue) const;
+
+    /**
+    *  @brief
+    *    Convert the referenced raw scalar into type T
+    *
+    *  @return
+    *    Converted value, T() if the view does not reference a raw scalar
+    *
+    *  @remarks
+    *    Raw scalars are converted like the scalars in a Variant (see ConvertScalar).
+    */
+    template <typename T>
+    T convertScalar() const;
+
+    /**
+    *  @brief
+    *    Initialize view to a typed value (helper functions for the constructor)
+    */
+    template <typename T, typename BASE>
+    void initTyped(const Typed<T, BASE> & value, std::false_type isVariant);
+    template <typename T, typename BASE>
+    void initTyped(const Typed<T, BASE> & value, std::true_type isVariant);
+
+
+protected:
+    const Variant       * m_variant; ///< Referenced variant (can be null)
+    const AbstractTyped * m_typed;   ///< Referenced typed value (can be null)
+    const void          * m_data;    ///< Referenced raw data (can be null)
+    VariantType           m_type;    ///< Type tag of the raw data or typed value
+};
+
+
+} // namespace cppexpose
+
+
+#include <cppexpose/variant/VariantView.inl>
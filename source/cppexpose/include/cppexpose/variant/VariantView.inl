@@ -0,0 +1,241 @@
+
+#pragma once
+
+
+namespace cppexpose
+{
+
+
+template <typename T>
+VariantView VariantView::fromValue(const T & value)
+{
+    static_assert(VariantTypeOf<T>::value >= VariantType::Bool && VariantTypeOf<T>::value <= VariantType::String,
+                  "VariantView::fromValue() only supports numbers, bool and std::string");
+
+    VariantView view;
+    view.m_data = &value;
+    view.m_type = VariantTypeOf<T>::value;
+    return view;
+}
+
+template <typename T, typename BASE>
+VariantView::VariantView(const Typed<T, BASE> & value)
+: VariantView()
+{
+    initTyped(value, typename std::is_same<T, Variant>::type());
+}
+
+template <typename T>
+bool VariantView::hasType() const
+{
+    if (m_variant) {
+        return m_variant->hasType<T>();
+    }
+
+    // Type is known from the tag
+    if (m_type != VariantType::Other) {
+        return m_type == VariantTypeOf<T>::value;
+    }
+
+    return m_typed && typeid(T) == m_typed->type();
+}
+
+template <typename T>
+bool VariantView::canConvert() const
+{
+    if (m_variant) {
+        return m_variant->canConvert<T>();
+    }
+
+    if (m_typed)
+    {
+        if (isVariantMap() || isVariantArray() || isPackedArray()) {
+            return ConvertVariant<T>::canConvert();
+        }
+
+        return m_typed->canConvert<T>();
+    }
+
+    // Raw scalars can be converted into all built-in scalar types
+    return m_data && ConvertScalar<T>::supported;
+}
+
+template <typename T>
+T VariantView::value(const T & defaultValue) const
+{
+    if (m_variant) {
+        return m_variant->value<T>(defaultValue);
+    }
+
+    // Type of the referenced data is the wanted type
+    if (auto data = ptr<T>()) {
+        return *data;
+    }
+
+    if (m_typed)
+    {
+        // Composite values are converted like variants
+        if (isVariantMap() || isVariantArray() || isPackedArray()) {
+            return m_typed->toVariant().value<T>(defaultValue);
+        }
+
+        return m_typed->convert<T>(defaultValue);
+    }
+
+    if (m_data && ConvertScalar<T>::supported) {
+        return convertScalar<T>();
+    }
+
+    return defaultValue;
+}
+
+template <typename T>
+const T * VariantView::ptr() const
+{
+    if (m_variant) {
+        return m_variant->ptr<T>();
+    }
+
+    if (m_data && hasType<T>()) {
+        return static_cast<const T *>(m_data);
+    }
+
+    return nullptr;
+}
+
+template <typename T>
+std::vector<T> VariantView::toVector() const
+{
+    if (m_variant) {
+        return m_variant->toVector<T>();
+    }
+
+    // Packed array of the requested type
+    if (auto data = ptr<std::vector<T>>()) {
+        return *data;
+    }
+
+    std::vector<T> vector;
+
+    if (auto array = asArray())
+    {
+        vector.reserve(array->size());
+
+        for (const auto & val : *array)
+        {
+            vector.push_back(val.value<T>());
+        }
+    }
+
+    else if (m_typed && (isVariantArray() || isPackedArray()))
+    {
+        // Data is not accessible, so the value has to be copied
+        vector = m_typed->toVariant().toVector<T>();
+    }
+
+    return vector;
+}
+
+template <typename R, typename Visitor>
+R VariantView::visitScalar(const Visitor & visitor, const R & defaultValue) const
+{
+    if (!m_data || m_typed) {
+        return defaultValue;
+    }
+
+    switch (m_type)
+    {
+        case VariantType::Bool:
+            return visitor(*static_cast<const bool *>(m_data));
+
+        case VariantType::Char:
+            return visitor(*static_cast<const char *>(m_data));
+
+        case VariantType::UnsignedChar:
+            return visitor(*static_cast<const unsigned char *>(m_data));
+
+        case VariantType::Short:
+            return visitor(*static_cast<const short *>(m_data));
+
+        case VariantType::UnsignedShort:
+            return visitor(*static_cast<const unsigned short *>(m_data));
+
+        case VariantType::Int:
+            return visitor(*static_cast<const int *>(m_data));
+
+        case VariantType::UnsignedInt:
+            return visitor(*static_cast<const unsigned int *>(m_data));
+
+        case VariantType::Long:
+            return visitor(*static_cast<const long *>(m_data));
+
+        case VariantType::UnsignedLong:
+            return visitor(*static_cast<const unsigned long *>(m_data));
+
+        case VariantType::LongLong:
+            return visitor(*static_cast<const long long *>(m_data));
+
+        case VariantType::UnsignedLongLong:
+            return visitor(*static_cast<const unsigned long long *>(m_data));
+
+        case VariantType::Float:
+            return visitor(*static_cast<const float *>(m_data));
+
+        case VariantType::Double:
+            return visitor(*static_cast<const double *>(m_data));
+
+        case VariantType::String:
+            return visitor(*static_cast<const std::string *>(m_data));
+
+        default:
+            return defaultValue;
+    }
+}
+
+/**
+*  @brief
+*    Visitor that converts a raw scalar into type T (see VariantView::convertScalar())
+*/
+template <typename T>
+struct ConvertScalarVisitor
+{
+    template <typename S>
+    T operator()(const S & value) const
+    {
+        return ConvertScalar<T>::convertTo(value);
+    }
+
+    T operator()(const std::string & value) const
+    {
+        return ConvertScalar<T>::parse(value);
+    }
+};
+
+template <typename T>
+T VariantView::convertScalar() const
+{
+    return visitScalar<T>(ConvertScalarVisitor<T>(), T());
+}
+
+template <typename T, typename BASE>
+void VariantView::initTyped(const Typed<T, BASE> & value, std::false_type)
+{
+    m_typed = &value;
+    m_data  = value.ptr();
+    m_type  = VariantTypeOf<T>::value;
+}
+
+template <typename T, typename BASE>
+void VariantView::initTyped(const Typed<T, BASE> & value, std::true_type)
+{
+    // View the variant itself, if it is accessible
+    m_variant = value.ptr();
+
+    if (!m_variant) {
+        m_typed = &value;
+        m_type  = VariantType::Other;
+    }
+}
+
+
+} // namespace cppexpose
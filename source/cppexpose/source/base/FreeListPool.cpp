@@ -0,0 +1,174 @@
+
+#include <cppexpose/base/FreeListPool.h>
+
+#include <new>
+
+#include <cppexpose/cppexpose_features.h>
+
+
+using namespace cppexpose;
+
+
+namespace
+{
+
+
+const size_t g_numSizeClasses = FreeListPool::maxBlockSize / FreeListPool::blockAlignment;
+
+
+/**
+*  @brief
+*    Block in a free list
+*/
+struct Block
+{
+    Block * next;
+};
+
+
+/**
+*  @brief
+*    Free lists of a thread
+*
+*  @remarks
+*    Trivial type, so it can be thread-local on all compilers and stays
+*    accessible while other thread-local objects are destroyed.
+*/
+struct FreeLists
+{
+    Block  * heads[g_numSizeClasses];
+    unsigned counts[g_numSizeClasses];
+    bool     active;   ///< 'true' if blocks are cached
+    bool     disabled; ///< 'true' if the thread is exiting
+};
+
+
+CPPEXPOSE_THREAD_LOCAL FreeLists g_freeLists;
+
+
+void releaseFreeLists()
+{
+    for (size_t i = 0; i < g_numSizeClasses; ++i)
+    {
+        while (Block * block = g_freeLists.heads[i])
+        {
+            g_freeLists.heads[i] = block->next;
+            ::operator delete(block);
+        }
+
+        g_freeLists.counts[i] = 0;
+    }
+}
+
+
+#if CPPEXPOSE_COMPILER_CXX_THREAD_LOCAL
+
+/**
+*  @brief
+*    Releases the cached blocks when the thread exits
+*/
+struct ThreadExitGuard
+{
+    ~ThreadExitGuard()
+    {
+        releaseFreeLists();
+        g_freeLists.disabled = true;
+    }
+
+    void activate()
+    {
+    }
+};
+
+thread_local ThreadExitGuard g_threadExitGuard;
+
+#endif
+
+
+size_t sizeClass(size_t size)
+{
+    return (size + FreeListPool::blockAlignment - 1) / FreeListPool::blockAlignment - 1;
+}
+
+
+} // namespace
+
+
+namespace cppexpose
+{
+
+
+void * FreeListPool::allocate(size_t size)
+{
+    if (size == 0 || size > maxBlockSize) {
+        return ::operator new(size);
+    }
+
+    const size_t index = sizeClass(size);
+
+    // Reuse cached block
+    if (Block * block = g_freeLists.heads[index])
+    {
+        g_freeLists.heads[index] = block->next;
+        g_freeLists.counts[index]--;
+        return block;
+    }
+
+    // Allocate blocks with the full size of their class, so they can be reused for all sizes of the class
+    return ::operator new((index + 1) * blockAlignment);
+}
+
+void FreeListPool::deallocate(void * ptr, size_t size)
+{
+    if (!ptr) {
+        return;
+    }
+
+    if (size == 0 || size > maxBlockSize || g_freeLists.disabled)
+    {
+        ::operator delete(ptr);
+        return;
+    }
+
+    const size_t index = sizeClass(size);
+
+    if (g_freeLists.counts[index] >= maxCachedBlocks)
+    {
+        ::operator delete(ptr);
+        return;
+    }
+
+    // Make sure that the cached blocks are released when the thread exits
+    if (!g_freeLists.active)
+    {
+#if CPPEXPOSE_COMPILER_CXX_THREAD_LOCAL
+        g_threadExitGuard.activate();
+#endif
+        g_freeLists.active = true;
+    }
+
+    Block * block = static_cast<Block *>(ptr);
+    block->next = g_freeLists.heads[index];
+
+    g_freeLists.heads[index] = block;
+    g_freeLists.counts[index]++;
+}
+
+void FreeListPool::release()
+{
+    releaseFreeLists();
+}
+
+size_t FreeListPool::numCachedBlocks()
+{
+    size_t count = 0;
+
+    for (size_t i = 0; i < g_numSizeClasses; ++i) {
+        count += g_freeLists.counts[i];
+    }
+
+    return count;
+}
+
+
+} // namespace cppexpose
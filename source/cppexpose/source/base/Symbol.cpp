@@ -0,0 +1,223 @@
+
+#include <cppexpose/base/Symbol.h>
+
+#include <atomic>
+#include <memory>
+#include <mutex>
+#include <unordered_set>
+#include <vector>
+
+
+namespace
+{
+
+
+/**
+*  @brief
+*    Open addressing hash table of pointers to interned strings
+*
+*    Slots are only ever filled, never cleared, so readers can probe
+*    them with atomic loads and without locking.
+*/
+struct SymbolSlots
+{
+    SymbolSlots(size_t capacity)
+    : mask(capacity - 1)
+    , entries(new std::atomic<const std::string *>[capacity])
+    {
+        for (size_t i = 0; i < capacity; i++) {
+            entries[i].store(nullptr, std::memory_order_relaxed);
+        }
+    }
+
+    const std::string * find(const std::string & str, size_t hash) const
+    {
+        for (size_t i = hash & mask; ; i = (i + 1) & mask)
+        {
+            const std::string * entry = entries[i].load(std::memory_order_acquire);
+
+            if (!entry || *entry == str) {
+                return entry;
+            }
+        }
+    }
+
+    void insert(const std::string * str, size_t hash)
+    {
+        size_t i = hash & mask;
+
+        while (entries[i].load(std::memory_order_relaxed)) {
+            i = (i + 1) & mask;
+        }
+
+        entries[i].store(str, std::memory_order_release);
+    }
+
+    size_t                                              mask;    ///< Capacity - 1 (capacity is a power of two)
+    std::unique_ptr<std::atomic<const std::string *>[]> entries; ///< Slots (null if empty)
+};
+
+/**
+*  @brief
+*    Global table of interned strings
+*
+*    Looking up strings is lock-free: readers probe the current slots, which
+*    are published atomically. Only interning new strings takes the mutex.
+*    When the slots are grown, the old slots are kept, as other threads may
+*    still read them, so at most twice the memory of the current slots is used.
+*
+*  @remarks
+*    The elements of an unordered set are not moved on rehashing,
+*    so pointers to the interned strings stay valid forever.
+*/
+struct SymbolTable
+{
+    SymbolTable()
+    : current(nullptr)
+    {
+        slots.emplace_back(new SymbolSlots(256));
+        current.store(slots.back().get(), std::memory_order_release);
+    }
+
+    std::mutex                                mutex;   ///< Protects strings and slots (for writers only)
+    std::unordered_set<std::string>           strings; ///< Interned strings
+    std::vector<std::unique_ptr<SymbolSlots>> slots;   ///< All slots that have been published
+    std::atomic<const SymbolSlots *>          current; ///< Slots to probe
+};
+
+SymbolTable & symbolTable()
+{
+    // Never destroyed, so symbols can be used during static destruction
+    static SymbolTable * table = new SymbolTable;
+    return *table;
+}
+
+const std::string * find(const std::string & str, size_t hash)
+{
+    return symbolTable().current.load(std::memory_order_acquire)->find(str, hash);
+}
+
+const std::string * intern(const std::string & str)
+{
+    const size_t hash = std::hash<std::string>()(str);
+
+    // Fast path: string has been interned before
+    if (const std::string * interned = find(str, hash)) {
+        return interned;
+    }
+
+    auto & table = symbolTable();
+
+    std::lock_guard<std::mutex> lock(table.mutex);
+
+    const auto result = table.strings.insert(str);
+    const std::string * interned = &*result.first;
+
+    // Publish new string (it may have been interned by another thread in the meantime)
+    if (result.second)
+    {
+        SymbolSlots * slots = table.slots.back().get();
+
+        // Keep the load factor below 1/2, so probe sequences stay short
+        if (table.strings.size() * 2 > slots->mask + 1)
+        {
+            table.slots.emplace_back(new SymbolSlots((slots->mask + 1) * 2));
+            slots = table.slots.back().get();
+
+            for (const auto & string : table.strings)
+            {
+                if (&string != interned) {
+                    slots->insert(&string, std::hash<std::string>()(string));
+                }
+            }
+
+            slots->insert(interned, hash);
+            table.current.store(slots, std::memory_order_release);
+        }
+        else
+        {
+            slots->insert(interned, hash);
+        }
+    }
+
+    return interned;
+}
+
+const std::string * emptyString()
+{
+    static const std::string * str = intern("");
+    return str;
+}
+
+
+} // namespace
+
+
+namespace cppexpose
+{
+
+
+bool Symbol::lookup(const std::string & str, Symbol & symbol)
+{
+    const std::string * interned = find(str, std::hash<std::string>()(str));
+
+    if (!interned) {
+        return false;
+    }
+
+    symbol.m_string = interned;
+    return true;
+}
+
+Symbol::Symbol()
+: m_string(emptyString())
+{
+}
+
+Symbol::Symbol(const std::string & str)
+: m_string(intern(str))
+{
+}
+
+Symbol::Symbol(const char * str)
+: m_string(intern(str ? std::string(str) : std::string()))
+{
+}
+
+const std::string & Symbol::str() const
+{
+    return *m_string;
+}
+
+Symbol::operator const std::string &() const
+{
+    return *m_string;
+}
+
+bool Symbol::empty() const
+{
+    return m_string->empty();
+}
+
+size_t Symbol::hash() const
+{
+    return std::hash<const std::string *>()(m_string);
+}
+
+bool Symbol::operator==(const Symbol & symbol) const
+{
+    return m_string == symbol.m_string;
+}
+
+bool Symbol::operator!=(const Symbol & symbol) const
+{
+    return m_string != symbol.m_string;
+}
+
+bool Symbol::operator<(const Symbol & symbol) const
+{
+    return m_string != symbol.m_string && *m_string < *symbol.m_string;
+}
+
+
+} // namespace cppexpose
@@ -10,9 +10,10 @@
 #include <cppassist/logging/logging.h>
 #include <cppassist/string/regex.h>
 #include <cppassist/fs/readfile.h>
-#include <cppassist/string/conversion.h>
 #include <cppassist/string/manipulation.h>
 
+#include <cppexpose/base/number_helpers.h>
+
 
 namespace
 {
@@ -624,8 +625,7 @@ Variant Tokenizer::decodeNumber(const Token & token) const
 }
 double Tokenizer::decodeDouble(const Token & token) const
 {
-    std::string buffer(token.begin, token.end-token.begin);
-    return cppassist::string::fromString<double>(buffer);
+    return helper::parseFloatingPoint(token.begin, token.end);
 }
 
 std::string Tokenizer::decodeString(const Token & token) const
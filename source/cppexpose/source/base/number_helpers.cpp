@@ -0,0 +1,208 @@
+
+#include <cppexpose/base/number_helpers.h>
+
+#include <cctype>
+#include <cfloat>
+#include <clocale>
+#include <cstdio>
+#include <cstdlib>
+#include <algorithm>
+
+
+namespace
+{
+
+
+char localeDecimalPoint()
+{
+    const char * decimalPoint = std::localeconv()->decimal_point;
+    return (decimalPoint && *decimalPoint) ? *decimalPoint : '.';
+}
+
+bool isDigit(char c)
+{
+    return c >= '0' && c <= '9';
+}
+
+const char * skipDigits(const char * current, const char * end)
+{
+    while (current != end && isDigit(*current)) {
+        ++current;
+    }
+
+    return current;
+}
+
+size_t formatToBuffer(char * buffer, size_t size, double value, int precision, char decimalPoint)
+{
+    const int length = std::snprintf(buffer, size, "%.*g", precision, value);
+
+    if (length < 0) {
+        buffer[0] = '\0';
+        return 0;
+    }
+
+    const size_t end = std::min(static_cast<size_t>(length), size - 1);
+
+    // Always use '.' as decimal point
+    if (decimalPoint != '.') {
+        std::replace(buffer, buffer + end, decimalPoint, '.');
+    }
+
+    return end;
+}
+
+template <typename T>
+std::string formatShortest(T value, int minPrecision, int maxPrecision)
+{
+    const char decimalPoint = localeDecimalPoint();
+
+    char buffer[64];
+    size_t length = 0;
+
+    // Numbers with up to minPrecision (i.e., DBL_DIG or FLT_DIG) digits always survive the round-trip,
+    // so if the value can be represented with fewer digits, it is formatted with them already
+    for (int precision = minPrecision; precision <= maxPrecision; precision++)
+    {
+        length = formatToBuffer(buffer, sizeof(buffer), static_cast<double>(value), precision, decimalPoint);
+
+        if (static_cast<T>(cppexpose::helper::parseFloatingPoint(buffer, buffer + length)) == value) {
+            break;
+        }
+    }
+
+    return std::string(buffer, length);
+}
+
+
+} // namespace
+
+
+namespace cppexpose
+{
+namespace helper
+{
+
+
+long long parseInteger(const std::string & str)
+{
+    return std::strtoll(str.c_str(), nullptr, 10);
+}
+
+unsigned long long parseUnsignedInteger(const std::string & str)
+{
+    return std::strtoull(str.c_str(), nullptr, 10);
+}
+
+char parseCharacter(const std::string & str)
+{
+    for (const char c : str)
+    {
+        if (!std::isspace(static_cast<unsigned char>(c))) {
+            return c;
+        }
+    }
+
+    return '\0';
+}
+
+double parseFloatingPoint(const std::string & str)
+{
+    return parseFloatingPoint(str.data(), str.data() + str.size());
+}
+
+double parseFloatingPoint(const char * begin, const char * end)
+{
+    // Skip whitespace
+    while (begin != end && std::isspace(static_cast<unsigned char>(*begin))) {
+        ++begin;
+    }
+
+    // Find the end of the number: [sign] digits [. digits] [exponent]
+    const char * current = begin;
+
+    if (current != end && (*current == '+' || *current == '-')) {
+        ++current;
+    }
+
+    const char * digits = current;
+    current = skipDigits(current, end);
+    bool hasDigits = current != digits;
+
+    if (current != end && *current == '.')
+    {
+        digits = ++current;
+        current = skipDigits(current, end);
+        hasDigits = hasDigits || current != digits;
+    }
+
+    if (!hasDigits) {
+        return 0.0;
+    }
+
+    if (current != end && (*current == 'e' || *current == 'E'))
+    {
+        const char * exponent = current + 1;
+
+        if (exponent != end && (*exponent == '+' || *exponent == '-')) {
+            ++exponent;
+        }
+
+        // Only consume the exponent if it contains digits
+        if (exponent != end && isDigit(*exponent)) {
+            current = skipDigits(exponent, end);
+        }
+    }
+
+    // Copy number, as strtod() requires a terminated string with the decimal point of the current locale
+    const size_t length = static_cast<size_t>(current - begin);
+    const char decimalPoint = localeDecimalPoint();
+
+    char buffer[64];
+    std::string longBuffer;
+    char * number = buffer;
+
+    if (length >= sizeof(buffer))
+    {
+        longBuffer.resize(length + 1);
+        number = &longBuffer[0];
+    }
+
+    std::replace_copy(begin, current, number, '.', decimalPoint);
+    number[length] = '\0';
+
+    return std::strtod(number, nullptr);
+}
+
+std::string formatInteger(long long value)
+{
+    return std::to_string(value);
+}
+
+std::string formatUnsignedInteger(unsigned long long value)
+{
+    return std::to_string(value);
+}
+
+std::string formatFloatingPoint(double value, int precision)
+{
+    char buffer[64];
+    const size_t length = formatToBuffer(buffer, sizeof(buffer), value, precision, localeDecimalPoint());
+
+    return std::string(buffer, length);
+}
+
+std::string formatShortestFloatingPoint(double value)
+{
+    // NaN never compares equal, so it ends up with the maximum precision, which is fine for "nan"
+    return formatShortest(value, DBL_DIG, DBL_DIG + 2);
+}
+
+std::string formatShortestFloatingPoint(float value)
+{
+    return formatShortest(value, FLT_DIG, FLT_DIG + 3);
+}
+
+
+} // namespace helper
+} // namespace cppexpose
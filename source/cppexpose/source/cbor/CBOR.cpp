@@ -0,0 +1,894 @@
+
+#include <cppexpose/cbor/CBOR.h>
+
+#include <cmath>
+#include <cstring>
+#include <limits>
+#include <fstream>
+#include <algorithm>
+#include <utility>
+
+#include <cppassist/logging/logging.h>
+
+#include <cppexpose/variant/Variant.h>
+
+
+using namespace cppexpose;
+
+
+namespace
+{
+
+
+// Major types
+const std::uint8_t g_majorUnsigned = 0;
+const std::uint8_t g_majorNegative = 1;
+const std::uint8_t g_majorBytes    = 2;
+const std::uint8_t g_majorText     = 3;
+const std::uint8_t g_majorArray    = 4;
+const std::uint8_t g_majorMap      = 5;
+const std::uint8_t g_majorTag      = 6;
+const std::uint8_t g_majorSimple   = 7;
+
+// Additional information
+const std::uint8_t g_infoFalse      = 20;
+const std::uint8_t g_infoTrue       = 21;
+const std::uint8_t g_infoNull       = 22;
+const std::uint8_t g_infoHalf       = 25;
+const std::uint8_t g_infoFloat      = 26;
+const std::uint8_t g_infoDouble     = 27;
+const std::uint8_t g_infoIndefinite = 31;
+
+// Typed array tags (RFC 8746)
+const std::uint64_t g_tagUInt8        = 64;
+const std::uint64_t g_tagInt32BE      = 74;
+const std::uint64_t g_tagInt64BE      = 75;
+const std::uint64_t g_tagUInt8Clamped = 68;
+const std::uint64_t g_tagInt32LE      = 78;
+const std::uint64_t g_tagInt64LE      = 79;
+const std::uint64_t g_tagFloatBE      = 81;
+const std::uint64_t g_tagDoubleBE     = 82;
+const std::uint64_t g_tagFloatLE      = 85;
+const std::uint64_t g_tagDoubleLE     = 86;
+
+// Maximum nesting depth of arrays, maps and tags when decoding
+const unsigned int g_maxDepth = 512;
+
+// Maximum number of bytes or elements that are allocated before the data has been read
+const size_t g_maxChunkSize = 1024 * 1024;
+
+// Maximum number of array elements that are reserved before the elements have been read
+const size_t g_maxReservedElements = 1024;
+
+
+bool isLittleEndian()
+{
+    const std::uint16_t value = 1;
+    std::uint8_t firstByte;
+    std::memcpy(&firstByte, &value, 1);
+
+    return firstByte == 1;
+}
+
+bool error(const char * message)
+{
+    cppassist::critical() << "CBOR: " << message << std::endl;
+    return false;
+}
+
+float decodeHalf(std::uint16_t half)
+{
+    const int exponent = (half >> 10) & 0x1f;
+    const int mantissa = half & 0x3ff;
+
+    float value;
+    if (exponent == 0)       value = std::ldexp(static_cast<float>(mantissa), -24);
+    else if (exponent != 31) value = std::ldexp(static_cast<float>(mantissa + 1024), exponent - 25);
+    else if (mantissa == 0)  value = std::numeric_limits<float>::infinity();
+    else                     value = std::numeric_limits<float>::quiet_NaN();
+
+    return (half & 0x8000) ? -value : value;
+}
+
+template <typename T>
+Variant decodePackedArray(const std::vector<std::uint8_t> & bytes, bool littleEndian)
+{
+    std::vector<T> values(bytes.size() / sizeof(T));
+
+    if (!values.empty()) {
+        std::memcpy(values.data(), bytes.data(), values.size() * sizeof(T));
+    }
+
+    // Convert byte order
+    if (sizeof(T) > 1 && littleEndian != isLittleEndian())
+    {
+        auto data = reinterpret_cast<std::uint8_t *>(values.data());
+
+        for (size_t i = 0; i < values.size(); ++i) {
+            std::reverse(data + i * sizeof(T), data + (i + 1) * sizeof(T));
+        }
+    }
+
+    return Variant(std::move(values));
+}
+
+
+/**
+*  @brief
+*    Output into a buffer
+*/
+class BufferWriter
+{
+public:
+    explicit BufferWriter(std::vector<std::uint8_t> & buffer)
+    : m_buffer(buffer)
+    {
+    }
+
+    void write(const void * data, size_t size)
+    {
+        auto bytes = static_cast<const std::uint8_t *>(data);
+        m_buffer.insert(m_buffer.end(), bytes, bytes + size);
+    }
+
+protected:
+    std::vector<std::uint8_t> & m_buffer;
+};
+
+
+/**
+*  @brief
+*    Output into a stream
+*/
+class StreamWriter
+{
+public:
+    explicit StreamWriter(std::ostream & stream)
+    : m_stream(stream)
+    {
+    }
+
+    void write(const void * data, size_t size)
+    {
+        m_stream.write(static_cast<const char *>(data), static_cast<std::streamsize>(size));
+    }
+
+protected:
+    std::ostream & m_stream;
+};
+
+
+/**
+*  @brief
+*    Input from a buffer
+*/
+class BufferReader
+{
+public:
+    BufferReader(const std::uint8_t * data, size_t size)
+    : m_current(data)
+    , m_end(data + size)
+    {
+    }
+
+    bool read(void * data, size_t size)
+    {
+        if (size > remaining()) {
+            return false;
+        }
+
+        std::memcpy(data, m_current, size);
+        m_current += size;
+        return true;
+    }
+
+    size_t remaining() const
+    {
+        return static_cast<size_t>(m_end - m_current);
+    }
+
+protected:
+    const std::uint8_t * m_current;
+    const std::uint8_t * m_end;
+};
+
+
+/**
+*  @brief
+*    Input from a stream
+*/
+class StreamReader
+{
+public:
+    explicit StreamReader(std::istream & stream)
+    : m_stream(stream)
+    {
+    }
+
+    bool read(void * data, size_t size)
+    {
+        m_stream.read(static_cast<char *>(data), static_cast<std::streamsize>(size));
+        return static_cast<size_t>(m_stream.gcount()) == size;
+    }
+
+    size_t remaining() const
+    {
+        // Unknown
+        return std::numeric_limits<size_t>::max();
+    }
+
+protected:
+    std::istream & m_stream;
+};
+
+
+/**
+*  @brief
+*    CBOR encoder
+*/
+template <typename Writer>
+class Encoder
+{
+public:
+    explicit Encoder(Writer & writer)
+    : m_writer(writer)
+    {
+    }
+
+    void encode(const Variant & value)
+    {
+        switch (value.variantType())
+        {
+            case VariantType::Bool:
+                writeSimple(value.value<bool>() ? g_infoTrue : g_infoFalse);
+                break;
+
+            case VariantType::Char:
+            case VariantType::Short:
+            case VariantType::Int:
+            case VariantType::Long:
+            case VariantType::LongLong:
+                writeInteger(value.value<long long>());
+                break;
+
+            case VariantType::UnsignedChar:
+            case VariantType::UnsignedShort:
+            case VariantType::UnsignedInt:
+            case VariantType::UnsignedLong:
+            case VariantType::UnsignedLongLong:
+                writeHead(g_majorUnsigned, value.value<unsigned long long>());
+                break;
+
+            case VariantType::Float:
+            {
+                std::uint32_t bits;
+                std::memcpy(&bits, value.ptr<float>(), sizeof(bits));
+
+                writeSimple(g_infoFloat);
+                writeBigEndian(bits, 4);
+                break;
+            }
+
+            case VariantType::Double:
+            {
+                std::uint64_t bits;
+                std::memcpy(&bits, value.ptr<double>(), sizeof(bits));
+
+                writeSimple(g_infoDouble);
+                writeBigEndian(bits, 8);
+                break;
+            }
+
+            case VariantType::String:
+                writeString(*value.ptr<std::string>());
+                break;
+
+            case VariantType::StringVector:
+            {
+                const auto & strings = *value.ptr<std::vector<std::string>>();
+                writeHead(g_majorArray, strings.size());
+
+                for (const auto & str : strings) {
+                    writeString(str);
+                }
+
+                break;
+            }
+
+            case VariantType::VariantArray:
+            {
+                const auto & array = *value.asArray();
+                writeHead(g_majorArray, array.size());
+
+                for (const auto & element : array) {
+                    encode(element);
+                }
+
+                break;
+            }
+
+            case VariantType::VariantMap:
+            {
+                const auto & map = *value.asMap();
+                writeHead(g_majorMap, map.size());
+
+                for (const auto & it : map)
+                {
+                    writeString(it.first);
+                    encode(it.second);
+                }
+
+                break;
+            }
+
+            case VariantType::FloatVector:
+                writeTypedArray(isLittleEndian() ? g_tagFloatLE : g_tagFloatBE, *value.ptr<std::vector<float>>());
+                break;
+
+            case VariantType::DoubleVector:
+                writeTypedArray(isLittleEndian() ? g_tagDoubleLE : g_tagDoubleBE, *value.ptr<std::vector<double>>());
+                break;
+
+            case VariantType::Int32Vector:
+                writeTypedArray(isLittleEndian() ? g_tagInt32LE : g_tagInt32BE, *value.ptr<std::vector<std::int32_t>>());
+                break;
+
+            case VariantType::Int64Vector:
+                writeTypedArray(isLittleEndian() ? g_tagInt64LE : g_tagInt64BE, *value.ptr<std::vector<std::int64_t>>());
+                break;
+
+            case VariantType::UInt8Vector:
+                writeTypedArray(g_tagUInt8, *value.ptr<std::vector<std::uint8_t>>());
+                break;
+
+            case VariantType::Other:
+                // Other primitive data types are stored as strings (like in JSON)
+                if (value.canConvert<std::string>()) {
+                    writeString(value.toString());
+                } else {
+                    writeSimple(g_infoNull);
+                }
+                break;
+
+            default:
+                writeSimple(g_infoNull);
+                break;
+        }
+    }
+
+protected:
+    void writeBigEndian(std::uint64_t value, size_t size)
+    {
+        std::uint8_t bytes[8];
+
+        for (size_t i = 0; i < size; ++i) {
+            bytes[i] = static_cast<std::uint8_t>(value >> (8 * (size - 1 - i)));
+        }
+
+        m_writer.write(bytes, size);
+    }
+
+    void writeHead(std::uint8_t major, std::uint64_t argument)
+    {
+        const std::uint8_t type = static_cast<std::uint8_t>(major << 5);
+
+        // Use the shortest encoding of the argument
+        if (argument < 24)
+        {
+            const std::uint8_t byte = type | static_cast<std::uint8_t>(argument);
+            m_writer.write(&byte, 1);
+        }
+
+        else
+        {
+            std::uint8_t info = 27;
+            size_t size = 8;
+
+            if (argument <= 0xffu)            { info = 24; size = 1; }
+            else if (argument <= 0xffffu)     { info = 25; size = 2; }
+            else if (argument <= 0xffffffffu) { info = 26; size = 4; }
+
+            const std::uint8_t byte = type | info;
+            m_writer.write(&byte, 1);
+            writeBigEndian(argument, size);
+        }
+    }
+
+    void writeSimple(std::uint8_t info)
+    {
+        const std::uint8_t byte = static_cast<std::uint8_t>(g_majorSimple << 5) | info;
+        m_writer.write(&byte, 1);
+    }
+
+    void writeInteger(long long value)
+    {
+        if (value >= 0) {
+            writeHead(g_majorUnsigned, static_cast<std::uint64_t>(value));
+        } else {
+            writeHead(g_majorNegative, static_cast<std::uint64_t>(-(value + 1)));
+        }
+    }
+
+    void writeString(const std::string & str)
+    {
+        writeHead(g_majorText, str.size());
+        m_writer.write(str.data(), str.size());
+    }
+
+    template <typename T>
+    void writeTypedArray(std::uint64_t tag, const std::vector<T> & values)
+    {
+        // Numbers are stored as a whole in native byte order
+        writeHead(g_majorTag, tag);
+        writeHead(g_majorBytes, values.size() * sizeof(T));
+        m_writer.write(values.data(), values.size() * sizeof(T));
+    }
+
+protected:
+    Writer & m_writer;
+};
+
+
+/**
+*  @brief
+*    CBOR decoder
+*/
+template <typename Reader>
+class Decoder
+{
+public:
+    explicit Decoder(Reader & reader)
+    : m_reader(reader)
+    {
+    }
+
+    bool decode(Variant & value, unsigned int depth = 0)
+    {
+        std::uint8_t major;
+        std::uint8_t info;
+        std::uint64_t argument;
+
+        if (!readHead(major, info, argument)) {
+            return false;
+        }
+
+        return decodeItem(value, major, info, argument, depth);
+    }
+
+protected:
+    bool readHead(std::uint8_t & major, std::uint8_t & info, std::uint64_t & argument)
+    {
+        std::uint8_t byte;
+        if (!m_reader.read(&byte, 1)) {
+            return error("Unexpected end of data");
+        }
+
+        major    = byte >> 5;
+        info     = byte & 0x1f;
+        argument = info;
+
+        // Argument is stored in the following bytes
+        if (info >= 24 && info <= 27)
+        {
+            const size_t size = size_t(1) << (info - 24);
+
+            std::uint8_t bytes[8];
+            if (!m_reader.read(bytes, size)) {
+                return error("Unexpected end of data");
+            }
+
+            argument = 0;
+            for (size_t i = 0; i < size; ++i) {
+                argument = (argument << 8) | bytes[i];
+            }
+        }
+
+        else if (info >= 28 && info <= 30)
+        {
+            return error("Invalid additional information");
+        }
+
+        else if (info == g_infoIndefinite && (major == g_majorUnsigned || major == g_majorNegative || major == g_majorTag))
+        {
+            return error("Invalid indefinite length");
+        }
+
+        return true;
+    }
+
+    bool isBreak(std::uint8_t major, std::uint8_t info) const
+    {
+        return major == g_majorSimple && info == g_infoIndefinite;
+    }
+
+    bool decodeItem(Variant & value, std::uint8_t major, std::uint8_t info, std::uint64_t argument, unsigned int depth)
+    {
+        if (depth > g_maxDepth) {
+            return error("Maximum nesting depth exceeded");
+        }
+
+        switch (major)
+        {
+            case g_majorUnsigned:
+                if (argument <= static_cast<std::uint64_t>(std::numeric_limits<int>::max()))               value = Variant(static_cast<int>(argument));
+                else if (argument <= static_cast<std::uint64_t>(std::numeric_limits<unsigned int>::max())) value = Variant(static_cast<unsigned int>(argument));
+                else                                                                                        value = Variant(static_cast<unsigned long long>(argument));
+                return true;
+
+            case g_majorNegative:
+                if (argument <= static_cast<std::uint64_t>(std::numeric_limits<int>::max()))            value = Variant(-1 - static_cast<int>(argument));
+                else if (argument <= static_cast<std::uint64_t>(std::numeric_limits<long long>::max())) value = Variant(-1ll - static_cast<long long>(argument));
+                else                                                                                     value = Variant(-1.0 - static_cast<double>(argument));
+                return true;
+
+            case g_majorBytes:
+            {
+                std::vector<std::uint8_t> bytes;
+                if (!readData(info, argument, g_majorBytes, bytes)) {
+                    return false;
+                }
+
+                value = Variant(std::move(bytes));
+                return true;
+            }
+
+            case g_majorText:
+            {
+                std::string str;
+                if (!readData(info, argument, g_majorText, str)) {
+                    return false;
+                }
+
+                value = Variant(std::move(str));
+                return true;
+            }
+
+            case g_majorArray:
+                return decodeArray(value, info, argument, depth);
+
+            case g_majorMap:
+                return decodeMap(value, info, argument, depth);
+
+            case g_majorTag:
+                return decodeTag(value, argument, depth);
+
+            default:
+                return decodeSimple(value, info, argument);
+        }
+    }
+
+    template <typename Container>
+    bool readData(std::uint8_t info, std::uint64_t argument, std::uint8_t major, Container & data)
+    {
+        if (info != g_infoIndefinite) {
+            return readChunk(argument, data);
+        }
+
+        // Indefinite length: concatenate chunks of the same major type
+        while (true)
+        {
+            std::uint8_t chunkMajor;
+            std::uint8_t chunkInfo;
+            std::uint64_t chunkSize;
+
+            if (!readHead(chunkMajor, chunkInfo, chunkSize)) {
+                return false;
+            }
+
+            if (isBreak(chunkMajor, chunkInfo)) {
+                return true;
+            }
+
+            if (chunkMajor != major || chunkInfo == g_infoIndefinite) {
+                return error("Invalid chunk in string of indefinite length");
+            }
+
+            if (!readChunk(chunkSize, data)) {
+                return false;
+            }
+        }
+    }
+
+    template <typename Container>
+    bool readChunk(std::uint64_t size, Container & data)
+    {
+        if (size > m_reader.remaining()) {
+            return error("Unexpected end of data");
+        }
+
+        // Allocate memory step by step, so an invalid size does not exhaust the memory
+        while (size > 0)
+        {
+            const size_t offset = data.size();
+            const size_t chunk  = static_cast<size_t>(std::min<std::uint64_t>(size, g_maxChunkSize));
+
+            data.resize(offset + chunk);
+            if (!m_reader.read(&data[offset], chunk)) {
+                return error("Unexpected end of data");
+            }
+
+            size -= chunk;
+        }
+
+        return true;
+    }
+
+    bool decodeArray(Variant & value, std::uint8_t info, std::uint64_t argument, unsigned int depth)
+    {
+        VariantArray array;
+
+        if (info == g_infoIndefinite)
+        {
+            while (true)
+            {
+                std::uint8_t major;
+                std::uint64_t elementArgument;
+
+                if (!readHead(major, info, elementArgument)) {
+                    return false;
+                }
+
+                if (isBreak(major, info)) {
+                    break;
+                }
+
+                array.emplace_back();
+                if (!decodeItem(array.back(), major, info, elementArgument, depth + 1)) {
+                    return false;
+                }
+            }
+        }
+
+        else
+        {
+            // Each element takes at least one byte
+            if (argument > m_reader.remaining()) {
+                return error("Unexpected end of data");
+            }
+
+            // Reserve only a few elements, because every nesting level can claim the full remaining size
+            array.reserve(static_cast<size_t>(std::min<std::uint64_t>(argument, g_maxReservedElements)));
+
+            for (std::uint64_t i = 0; i < argument; ++i)
+            {
+                array.emplace_back();
+                if (!decode(array.back(), depth + 1)) {
+                    return false;
+                }
+            }
+        }
+
+        value = Variant(std::move(array));
+        return true;
+    }
+
+    bool decodeMap(Variant & value, std::uint8_t info, std::uint64_t argument, unsigned int depth)
+    {
+        VariantMap map;
+
+        const bool indefinite = info == g_infoIndefinite;
+
+        for (std::uint64_t i = 0; indefinite || i < argument; ++i)
+        {
+            std::uint8_t major;
+            std::uint64_t keyArgument;
+
+            if (!readHead(major, info, keyArgument)) {
+                return false;
+            }
+
+            if (indefinite && isBreak(major, info)) {
+                break;
+            }
+
+            // Get key (keys that are not strings are converted into strings)
+            std::string key;
+
+            if (major == g_majorText)
+            {
+                if (!readData(info, keyArgument, g_majorText, key)) {
+                    return false;
+                }
+            }
+
+            else
+            {
+                Variant keyValue;
+                if (!decodeItem(keyValue, major, info, keyArgument, depth + 1)) {
+                    return false;
+                }
+
+                key = keyValue.toString();
+            }
+
+            // Get value
+            if (!decode(map[std::move(key)], depth + 1)) {
+                return false;
+            }
+        }
+
+        value = Variant(std::move(map));
+        return true;
+    }
+
+    bool decodeTag(Variant & value, std::uint64_t tag, unsigned int depth)
+    {
+        const bool isTypedArray = tag == g_tagUInt8 || tag == g_tagUInt8Clamped ||
+                                  tag == g_tagInt32BE || tag == g_tagInt32LE ||
+                                  tag == g_tagInt64BE || tag == g_tagInt64LE ||
+                                  tag == g_tagFloatBE || tag == g_tagFloatLE ||
+                                  tag == g_tagDoubleBE || tag == g_tagDoubleLE;
+
+        // Other tags are ignored, the tagged item is decoded as usual
+        if (!isTypedArray) {
+            return decode(value, depth + 1);
+        }
+
+        // Typed arrays are stored in byte strings
+        std::uint8_t major;
+        std::uint8_t info;
+        std::uint64_t argument;
+
+        if (!readHead(major, info, argument)) {
+            return false;
+        }
+
+        if (major != g_majorBytes) {
+            return error("Typed array is not a byte string");
+        }
+
+        std::vector<std::uint8_t> bytes;
+        if (!readData(info, argument, g_majorBytes, bytes)) {
+            return false;
+        }
+
+        switch (tag)
+        {
+            case g_tagInt32BE:
+            case g_tagInt32LE:
+                if (bytes.size() % 4 != 0) return error("Invalid size of typed array");
+                value = decodePackedArray<std::int32_t>(bytes, tag == g_tagInt32LE);
+                return true;
+
+            case g_tagInt64BE:
+            case g_tagInt64LE:
+                if (bytes.size() % 8 != 0) return error("Invalid size of typed array");
+                value = decodePackedArray<std::int64_t>(bytes, tag == g_tagInt64LE);
+                return true;
+
+            case g_tagFloatBE:
+            case g_tagFloatLE:
+                if (bytes.size() % 4 != 0) return error("Invalid size of typed array");
+                value = decodePackedArray<float>(bytes, tag == g_tagFloatLE);
+                return true;
+
+            case g_tagDoubleBE:
+            case g_tagDoubleLE:
+                if (bytes.size() % 8 != 0) return error("Invalid size of typed array");
+                value = decodePackedArray<double>(bytes, tag == g_tagDoubleLE);
+                return true;
+
+            default:
+                value = Variant(std::move(bytes));
+                return true;
+        }
+    }
+
+    bool decodeSimple(Variant & value, std::uint8_t info, std::uint64_t argument)
+    {
+        switch (info)
+        {
+            case g_infoFalse:
+                value = Variant(false);
+                return true;
+
+            case g_infoTrue:
+                value = Variant(true);
+                return true;
+
+            case g_infoHalf:
+                value = Variant(decodeHalf(static_cast<std::uint16_t>(argument)));
+                return true;
+
+            case g_infoFloat:
+            {
+                const std::uint32_t bits = static_cast<std::uint32_t>(argument);
+                float number;
+                std::memcpy(&number, &bits, sizeof(number));
+
+                value = Variant(number);
+                return true;
+            }
+
+            case g_infoDouble:
+            {
+                double number;
+                std::memcpy(&number, &argument, sizeof(number));
+
+                value = Variant(number);
+                return true;
+            }
+
+            case g_infoIndefinite:
+                return error("Unexpected break");
+
+            default:
+                // Null, undefined and unassigned simple values
+                value = Variant();
+                return true;
+        }
+    }
+
+protected:
+    Reader & m_reader;
+};
+
+
+} // namespace
+
+
+namespace cppexpose
+{
+
+
+std::vector<std::uint8_t> CBOR::encode(const Variant & root)
+{
+    std::vector<std::uint8_t> buffer;
+
+    BufferWriter writer(buffer);
+    Encoder<BufferWriter>(writer).encode(root);
+
+    return buffer;
+}
+
+bool CBOR::encode(const Variant & root, std::ostream & stream)
+{
+    StreamWriter writer(stream);
+    Encoder<StreamWriter>(writer).encode(root);
+
+    return stream.good();
+}
+
+bool CBOR::save(const Variant & root, const std::string & filename)
+{
+    std::ofstream stream(filename, std::ios::out | std::ios::binary);
+    if (!stream)
+    {
+        cppassist::critical() << "Could not open file '" << filename << "' for writing." << std::endl;
+        return false;
+    }
+
+    return encode(root, stream);
+}
+
+bool CBOR::decode(Variant & root, const std::vector<std::uint8_t> & buffer)
+{
+    return decode(root, buffer.data(), buffer.size());
+}
+
+bool CBOR::decode(Variant & root, const std::uint8_t * data, size_t size)
+{
+    BufferReader reader(data, size);
+    return Decoder<BufferReader>(reader).decode(root);
+}
+
+bool CBOR::decode(Variant & root, std::istream & stream)
+{
+    StreamReader reader(stream);
+    return Decoder<StreamReader>(reader).decode(root);
+}
+
+bool CBOR::load(Variant & root, const std::string & filename)
+{
+    std::ifstream stream(filename, std::ios::in | std::ios::binary);
+    if (!stream)
+    {
+        cppassist::critical() << "Could not open file '" << filename << "'." << std::endl;
+        return false;
+    }
+
+    return decode(root, stream);
+}
+
+
+} // namespace cppexpose
@@ -2,10 +2,12 @@
 #include <cppexpose/json/JSON.h>
 
 #include <iostream>
+#include <cstdint>
+#include <utility>
 
-#include <cppassist/string/conversion.h>
 #include <cppassist/logging/logging.h>
 
+#include <cppexpose/base/number_helpers.h>
 #include <cppexpose/base/Tokenizer.h>
 #include <cppexpose/variant/Variant.h>
 
@@ -57,6 +59,63 @@ std::string escapeString(const std::string & in)
     return out;
 }
 
+std::string packedElementToString(const float & value)
+{
+    return cppexpose::helper::formatShortestFloatingPoint(value);
+}
+
+std::string packedElementToString(const double & value)
+{
+    return cppexpose::helper::formatShortestFloatingPoint(value);
+}
+
+std::string packedElementToString(const std::int32_t & value)
+{
+    return cppexpose::helper::formatInteger(value);
+}
+
+std::string packedElementToString(const std::int64_t & value)
+{
+    return cppexpose::helper::formatInteger(value);
+}
+
+std::string packedElementToString(const std::uint8_t & value)
+{
+    // Output as number, not as character
+    return cppexpose::helper::formatUnsignedInteger(value);
+}
+
+template <typename T>
+std::string packedStringify(const std::vector<T> & values, bool beautify, const std::string & indent)
+{
+    // Quick output: [] if empty
+    if (values.empty())
+        return "[]";
+
+    // Begin output
+    std::string json = "[";
+    if (beautify) json += "\n";
+
+    // Add all elements
+    bool first = true;
+    for (const auto & element : values)
+    {
+        // Add separator (",")
+        if (!first)
+            json += beautify ? ",\n" : ",";
+        else
+            first = false;
+
+        // Add value to JSON
+        json += (beautify ? (indent + "    " + packedElementToString(element)) : packedElementToString(element));
+    }
+
+    // Finish JSON
+    json += (beautify ? "\n" + indent + "]" : "]");
+
+    return json;
+}
+
 std::string jsonStringify(const Variant & root, bool beautify, const std::string & indent)
 {
     // Variant is an object
@@ -87,7 +146,7 @@ std::string jsonStringify(const Variant & root, bool beautify, const std::string
 
             // Get value
             std::string value;
-            if (var.isVariantMap() || var.isVariantArray())
+            if (var.isVariantMap() || var.isVariantArray() || var.isPackedArray())
             {
                 value = jsonStringify(var, beautify, indent + "    ");
             }
@@ -138,7 +197,7 @@ std::string jsonStringify(const Variant & root, bool beautify, const std::string
 
             // Get value
             std::string value;
-            if (var.isVariantMap() || var.isVariantArray())
+            if (var.isVariantMap() || var.isVariantArray() || var.isPackedArray())
             {
                 value = jsonStringify(var, beautify, indent + "    ");
             }
@@ -166,6 +225,28 @@ std::string jsonStringify(const Variant & root, bool beautify, const std::string
         return json;
     }
 
+    // Variant is a packed numeric array
+    else if (root.isPackedArray())
+    {
+        switch (root.variantType())
+        {
+            case VariantType::FloatVector:
+                return packedStringify(*root.ptr<std::vector<float>>(), beautify, indent);
+
+            case VariantType::DoubleVector:
+                return packedStringify(*root.ptr<std::vector<double>>(), beautify, indent);
+
+            case VariantType::Int32Vector:
+                return packedStringify(*root.ptr<std::vector<std::int32_t>>(), beautify, indent);
+
+            case VariantType::Int64Vector:
+                return packedStringify(*root.ptr<std::vector<std::int64_t>>(), beautify, indent);
+
+            default:
+                return packedStringify(*root.ptr<std::vector<std::uint8_t>>(), beautify, indent);
+        }
+    }
+
     // Primitive data types
     else if (root.canConvert<std::string>())
     {
@@ -216,7 +297,7 @@ bool readValue(Variant & value, Tokenizer::Token & token, Tokenizer & tokenizer)
              token.type == Tokenizer::TokenBoolean ||
              token.type == Tokenizer::TokenNull)
     {
-        value = token.value;
+        value = std::move(token.value);
         return true;
     }
 
@@ -250,8 +331,8 @@ bool readArray(Variant & root, Tokenizer & tokenizer)
     while (true)
     {
         // Add new value to array
-        root.asArray()->push_back(Variant());
-        Variant & value = (*root.asArray())[root.asArray()->size() - 1];
+        root.asArray()->emplace_back();
+        Variant & value = root.asArray()->back();
 
         // Read value
         if (!readValue(value, token, tokenizer))
@@ -1,6 +1,8 @@
 
 #include <cppexpose/reflection/AbstractProperty.h>
 
+#include <atomic>
+
 #include <cppexpose/reflection/Object.h>
 
 
@@ -10,6 +12,8 @@ namespace
 
 const auto emptyVariant = cppexpose::Variant();
 
+std::atomic<cppexpose::AbstractProperty::SetMode> g_defaultSetMode(cppexpose::AbstractProperty::SetMode::Always);
+
 
 } // namespace
 
@@ -18,15 +22,27 @@ namespace cppexpose
 {
 
 
+AbstractProperty::SetMode AbstractProperty::defaultSetMode()
+{
+    return g_defaultSetMode.load(std::memory_order_relaxed);
+}
+
+void AbstractProperty::setDefaultSetMode(SetMode mode)
+{
+    g_defaultSetMode.store(mode == SetMode::Default ? SetMode::Always : mode, std::memory_order_relaxed);
+}
+
 AbstractProperty::AbstractProperty()
-: m_name("")
+: m_name()
 , m_parent(nullptr)
+, m_setMode(SetMode::Default)
 {
 }
 
 AbstractProperty::AbstractProperty(const Variant & options)
-: m_name("")
+: m_name()
 , m_parent(nullptr)
+, m_setMode(SetMode::Default)
 {
     if (options.isVariantMap())
     {
@@ -45,6 +61,11 @@ AbstractProperty::~AbstractProperty()
 }
 
 const std::string & AbstractProperty::name() const
+{
+    return m_name.str();
+}
+
+const Symbol & AbstractProperty::nameSymbol() const
 {
     return m_name;
 }
@@ -123,6 +144,23 @@ bool AbstractProperty::removeOption(const std::string & key)
     return true;
 }
 
+AbstractProperty::SetMode AbstractProperty::setMode() const
+{
+    return m_setMode;
+}
+
+void AbstractProperty::setSetMode(SetMode mode)
+{
+    m_setMode = mode;
+}
+
+bool AbstractProperty::skipsUnchangedValues() const
+{
+    const SetMode mode = (m_setMode == SetMode::Default) ? defaultSetMode() : m_setMode;
+
+    return mode == SetMode::IfChanged;
+}
+
 void AbstractProperty::initProperty(const std::string & name, Object * parent)
 {
     // Store name
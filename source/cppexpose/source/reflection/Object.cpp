@@ -1,14 +1,14 @@
 
 #include <cppexpose/reflection/Object.h>
 
+#include <atomic>
 #include <cassert>
 #include <typeinfo>
 
 #include <unordered_set>
 
-#include <cppassist/string/manipulation.h>
-
 #include <cppexpose/json/JSON.h>
+#include <cppexpose/variant/VariantPatch.h>
 
 
 namespace
@@ -16,6 +16,22 @@ namespace
     const char g_separator = '.';
     const std::string g_separatorString = ".";
     const std::string g_parent = "parent";
+
+    std::atomic<unsigned long long> g_structureGeneration(1);
+
+    const cppexpose::Symbol & parentSymbol()
+    {
+        static const cppexpose::Symbol symbol(g_parent);
+        return symbol;
+    }
+
+    const cppexpose::AbstractProperty * subProperty(const cppexpose::AbstractProperty * property, const cppexpose::Symbol & name)
+    {
+        const auto & properties = static_cast<const cppexpose::Object *>(property)->properties();
+        const auto it = properties.find(name);
+
+        return (it != properties.end()) ? it->second : nullptr;
+    }
 }
 
 
@@ -23,6 +39,11 @@ namespace cppexpose
 {
 
 
+unsigned long long Object::structureGeneration()
+{
+    return g_structureGeneration.load(std::memory_order_relaxed);
+}
+
 Object::Object()
 : Object("")
 {
@@ -59,14 +80,20 @@ void Object::clear()
     }
 }
 
-const std::unordered_map<std::string, AbstractProperty *> & Object::properties() const
+const std::unordered_map<Symbol, AbstractProperty *> & Object::properties() const
 {
     return m_propertiesMap;
 }
 
 bool Object::propertyExists(const std::string & name) const
 {
-    return m_propertiesMap.find(name) != m_propertiesMap.end();
+    // If the name has never been interned, no property can have it
+    Symbol symbol;
+    if (!Symbol::lookup(name, symbol)) {
+        return false;
+    }
+
+    return m_propertiesMap.find(symbol) != m_propertiesMap.end();
 }
 
 AbstractProperty * Object::property(size_t index)
@@ -89,14 +116,22 @@ const AbstractProperty * Object::property(size_t index) const
 
 AbstractProperty * Object::property(const std::string & path)
 {
-    std::vector<std::string> splittedPath = cppassist::string::split(path, g_separator);
-    return const_cast<AbstractProperty *>(findProperty(splittedPath));
+    return const_cast<AbstractProperty *>(findProperty(path));
 }
 
 const AbstractProperty * Object::property(const std::string & path) const
 {
-    std::vector<std::string> splittedPath = cppassist::string::split(path, g_separator);
-    return findProperty(splittedPath);
+    return findProperty(path);
+}
+
+AbstractProperty * Object::property(const PropertyPath & path)
+{
+    return const_cast<AbstractProperty *>(findProperty(path));
+}
+
+const AbstractProperty * Object::property(const PropertyPath & path) const
+{
+    return findProperty(path);
 }
 
 bool Object::addProperty(AbstractProperty * property)
@@ -117,7 +152,8 @@ bool Object::addProperty(AbstractProperty * property)
 
     // Add property
     m_properties.push_back(property);
-    m_propertiesMap.insert(std::make_pair(property->name(), property));
+    m_propertiesMap.insert(std::make_pair(property->nameSymbol(), property));
+    g_structureGeneration.fetch_add(1, std::memory_order_relaxed);
 
     // Invoke callback
     afterAdd(newIndex, property);
@@ -162,7 +198,8 @@ bool Object::removeProperty(AbstractProperty * property)
 
     // Remove property from object
     m_properties.erase(it);
-    m_propertiesMap.erase(property->name());
+    m_propertiesMap.erase(property->nameSymbol());
+    g_structureGeneration.fetch_add(1, std::memory_order_relaxed);
 
     // Reset property parent
     property->setParent(nullptr);
@@ -204,7 +241,14 @@ const std::type_info & Object::type() const
 
 std::string Object::typeName() const
 {
-    return "Object";
+    return typeDescriptor().name();
+}
+
+const TypeDescriptor & Object::typeDescriptor() const
+{
+    static const TypeDescriptor descriptor(typeid(Object), "Object", sizeof(Object), TypeDescriptor::Composite);
+
+    return descriptor;
 }
 
 bool Object::isReadOnly() const
@@ -444,18 +488,97 @@ std::string Object::relativePathTo(const Object * const other) const
     return relativePath;
 }
 
-const AbstractProperty * Object::findProperty(const std::vector<std::string> & path) const
+bool Object::applyPatch(const VariantPatch & patch)
+{
+    bool success = true;
+
+    for (const auto & change : patch.changes())
+    {
+        const auto & path = change.path;
+
+        // Find the innermost property on the path
+        AbstractProperty * property = this;
+        size_t depth = 0;
+
+        while (depth < path.size() && property->isObject())
+        {
+            auto object = static_cast<Object *>(property);
+
+            Symbol symbol;
+            const auto it = Symbol::lookup(path[depth], symbol) ? object->m_propertiesMap.find(symbol) : object->m_propertiesMap.end();
+
+            if (it == object->m_propertiesMap.end()) {
+                break;
+            }
+
+            property = it->second;
+            depth++;
+        }
+
+        // Abort if the path leads to an object property that does not exist
+        if (depth < path.size() && property->isObject())
+        {
+            success = false;
+            continue;
+        }
+
+        // Properties are not removed
+        if (depth == path.size() && change.operation == VariantPatch::Operation::Remove) {
+            continue;
+        }
+
+        // Update property value
+        if (depth == path.size())
+        {
+            property->fromVariant(change.value);
+        }
+
+        // Update a part of the property value
+        else
+        {
+            Variant value = property->toVariant();
+
+            if (VariantPatch::applyChange(value, change, depth)) {
+                property->fromVariant(value);
+            } else {
+                success = false;
+            }
+        }
+    }
+
+    return success;
+}
+
+const AbstractProperty * Object::findProperty(const std::string & path) const
 {
     // Find property
     const AbstractProperty * property = this;
 
-    auto current = path.begin();
-    const auto end = path.end();
+    // Walk along the path without splitting it, reusing the buffer for the names
+    std::string name;
+    bool hasSegments = false;
+    size_t begin = 0;
 
-    while (current != end)
+    while (begin <= path.size())
     {
-        // Get property name (first part of the path)
-        const std::string & name = *current;
+        size_t end = path.find(g_separator, begin);
+        if (end == std::string::npos) {
+            end = path.size();
+        }
+
+        // Skip empty segments
+        if (end == begin)
+        {
+            begin = end + 1;
+            continue;
+        }
+
+        // Properties in the middle of the path must be objects
+        if (hasSegments && !property->isObject()) {
+            return nullptr;
+        }
+
+        name.assign(path, begin, end - begin);
 
         if (name == g_parent)
         {
@@ -464,18 +587,9 @@ const AbstractProperty * Object::findProperty(const std::vector<std::string> & p
         }
         else
         {
-            // Sub-property
-            auto object = static_cast<const Object *>(property);
-            const auto it = object->m_propertiesMap.find(name);
-
-            if (it != object->m_propertiesMap.end())
-            {
-                property = it->second;
-            }
-            else
-            {
-                property = nullptr;
-            }
+            // Sub-property (if the name has never been interned, no property can have it)
+            Symbol symbol;
+            property = Symbol::lookup(name, symbol) ? subProperty(property, symbol) : nullptr;
         }
 
         // Check if property exists
@@ -483,21 +597,45 @@ const AbstractProperty * Object::findProperty(const std::vector<std::string> & p
             return nullptr;
         }
 
-        // Compute next path segment
-        ++current;
+        hasSegments = true;
+        begin = end + 1;
+    }
 
-        // If there are no more sub-paths, return the found property
-        if (current == end) {
-            return property;
-        }
+    return hasSegments ? property : nullptr;
+}
 
-        // Otherwise, it is an element in the middle of the path, so ensure it is an object
-        if (!property->isObject()) {
-            return nullptr;
+const AbstractProperty * Object::findProperty(const PropertyPath & path) const
+{
+    // Use cached property, if the structure has not changed since
+    const unsigned long long generation = structureGeneration();
+
+    if (path.m_cachedObject == this && path.m_cachedGeneration == generation) {
+        return path.m_cachedProperty;
+    }
+
+    // Find property
+    const AbstractProperty * property = path.isEmpty() ? nullptr : this;
+
+    for (size_t i = 0; property && i < path.m_segments.size(); i++)
+    {
+        // Properties in the middle of the path must be objects
+        if (i > 0 && !property->isObject())
+        {
+            property = nullptr;
+            break;
         }
+
+        const Symbol & name = path.m_segments[i];
+
+        property = (name == parentSymbol()) ? property->m_parent : subProperty(property, name);
     }
 
-    return nullptr;
+    // Update cache
+    path.m_cachedObject = this;
+    path.m_cachedProperty = property;
+    path.m_cachedGeneration = generation;
+
+    return property;
 }
 
 
@@ -0,0 +1,73 @@
+
+#include <cppexpose/reflection/PropertyPath.h>
+
+
+namespace
+{
+    const char g_separator = '.';
+}
+
+
+namespace cppexpose
+{
+
+
+PropertyPath::PropertyPath()
+: m_cachedObject(nullptr)
+, m_cachedProperty(nullptr)
+, m_cachedGeneration(0)
+{
+}
+
+PropertyPath::PropertyPath(const std::string & path)
+: m_path(path)
+, m_cachedObject(nullptr)
+, m_cachedProperty(nullptr)
+, m_cachedGeneration(0)
+{
+    size_t begin = 0;
+
+    while (begin <= path.size())
+    {
+        size_t end = path.find(g_separator, begin);
+        if (end == std::string::npos) {
+            end = path.size();
+        }
+
+        if (end > begin) {
+            m_segments.emplace_back(path.substr(begin, end - begin));
+        }
+
+        begin = end + 1;
+    }
+}
+
+PropertyPath::PropertyPath(const char * path)
+: PropertyPath(std::string(path))
+{
+}
+
+const std::string & PropertyPath::str() const
+{
+    return m_path;
+}
+
+const std::vector<Symbol> & PropertyPath::segments() const
+{
+    return m_segments;
+}
+
+bool PropertyPath::isEmpty() const
+{
+    return m_segments.empty();
+}
+
+void PropertyPath::invalidate() const
+{
+    m_cachedObject = nullptr;
+    m_cachedProperty = nullptr;
+    m_cachedGeneration = 0;
+}
+
+
+} // namespace cppexpose
@@ -1,6 +1,10 @@
 
 #include "DuktapeScriptBackend.h"
 
+#include <cstring>
+#include <cstdint>
+#include <utility>
+
 #include <cppassist/logging/logging.h>
 
 #include <cppexpose/reflection/Object.h>
@@ -13,6 +17,67 @@
 using namespace cppassist;
 
 
+namespace
+{
+
+
+template <typename T>
+void pushTypedArray(duk_context * context, const std::vector<T> & values, duk_uint_t type)
+{
+    // Copy data into a new buffer
+    const duk_size_t size = values.size() * sizeof(T);
+    void * buffer = duk_push_fixed_buffer(context, size);
+
+    if (size > 0) {
+        std::memcpy(buffer, values.data(), size);
+    }
+
+    // Create typed array view and remove the plain buffer from the stack
+    duk_push_buffer_object(context, -1, 0, size, type);
+    duk_remove(context, -2);
+}
+
+template <typename T>
+void pushNumberArray(duk_context * context, const std::vector<T> & values)
+{
+    duk_idx_t arr_idx = duk_push_array(context);
+
+    for (size_t i = 0; i < values.size(); i++) {
+        duk_push_number(context, static_cast<double>(values[i]));
+        duk_put_prop_index(context, arr_idx, static_cast<duk_uarridx_t>(i));
+    }
+}
+
+template <typename T>
+cppexpose::Variant readTypedArray(duk_context * context, duk_idx_t index)
+{
+    duk_size_t size = 0;
+    const void * data = duk_get_buffer_data(context, index, &size);
+
+    std::vector<T> values(size / sizeof(T));
+
+    if (!values.empty()) {
+        std::memcpy(values.data(), data, values.size() * sizeof(T));
+    }
+
+    return cppexpose::Variant(std::move(values));
+}
+
+bool isInstanceOf(duk_context * context, duk_idx_t index, const char * constructor)
+{
+    index = duk_normalize_index(context, index);
+
+    duk_get_global_string(context, constructor);
+    const bool result = duk_instanceof(context, index, -1) != 0;
+    duk_pop(context);
+
+    return result;
+}
+
+
+} // namespace
+
+
 namespace cppexpose
 {
 
@@ -184,6 +249,33 @@ Variant DuktapeScriptBackend::fromDukStack(duk_idx_t index)
         return Variant(str);
     }
 
+    // Typed array (all typed arrays inherit BYTES_PER_ELEMENT from their prototype)
+    else if (duk_is_object(m_context, index) && duk_has_prop_string(m_context, index, "BYTES_PER_ELEMENT"))
+    {
+        // Typed arrays that match a packed array type are copied as a whole
+        if (isInstanceOf(m_context, index, "Float32Array")) {
+            return readTypedArray<float>(m_context, index);
+        } else if (isInstanceOf(m_context, index, "Float64Array")) {
+            return readTypedArray<double>(m_context, index);
+        } else if (isInstanceOf(m_context, index, "Int32Array")) {
+            return readTypedArray<std::int32_t>(m_context, index);
+        } else if (isInstanceOf(m_context, index, "Uint8Array")) {
+            return readTypedArray<std::uint8_t>(m_context, index);
+        }
+
+        // Other typed arrays are converted element-wise
+        VariantArray array;
+
+        for (unsigned int i = 0; i < duk_get_length(m_context, index); ++i)
+        {
+            duk_get_prop_index(m_context, index, i);
+            array.push_back(fromDukStack());
+            duk_pop(m_context);
+        }
+
+        return Variant(std::move(array));
+    }
+
     // Array
     else if (duk_is_array(m_context, index))
     {
@@ -196,7 +288,7 @@ Variant DuktapeScriptBackend::fromDukStack(duk_idx_t index)
             duk_pop(m_context);
         }
 
-        return array;
+        return Variant(std::move(array));
     }
 
     // Object
@@ -226,7 +318,7 @@ Variant DuktapeScriptBackend::fromDukStack(duk_idx_t index)
         duk_enum(m_context, index, 0);
         while (duk_next(m_context, -1, 1)) // Push next key (-2) & value (-1)
         {
-            map.insert({fromDukStack(-2).value<std::string>(), fromDukStack(-1)});
+            map.emplace(fromDukStack(-2).value<std::string>(), fromDukStack(-1));
 
             // Pop key & value
             duk_pop_2(m_context);
@@ -235,7 +327,7 @@ Variant DuktapeScriptBackend::fromDukStack(duk_idx_t index)
         // Pop enumerator
         duk_pop(m_context);
 
-        return Variant(map);
+        return Variant(std::move(map));
     }
 
     // Pointer
@@ -283,9 +375,36 @@ void DuktapeScriptBackend::pushToDukStack(const Variant & value)
         duk_push_string(m_context, value.value<char*>());
     }
 
+    else if (value.isPackedArray())
+    {
+        switch (value.variantType())
+        {
+            case VariantType::FloatVector:
+                pushTypedArray(m_context, *value.ptr<std::vector<float>>(), DUK_BUFOBJ_FLOAT32ARRAY);
+                break;
+
+            case VariantType::DoubleVector:
+                pushTypedArray(m_context, *value.ptr<std::vector<double>>(), DUK_BUFOBJ_FLOAT64ARRAY);
+                break;
+
+            case VariantType::Int32Vector:
+                pushTypedArray(m_context, *value.ptr<std::vector<std::int32_t>>(), DUK_BUFOBJ_INT32ARRAY);
+                break;
+
+            case VariantType::UInt8Vector:
+                pushTypedArray(m_context, *value.ptr<std::vector<std::uint8_t>>(), DUK_BUFOBJ_UINT8ARRAY);
+                break;
+
+            default:
+                // There are no 64 bit typed arrays in Duktape, so use a regular array of numbers
+                pushNumberArray(m_context, *value.ptr<std::vector<std::int64_t>>());
+                break;
+        }
+    }
+
     else if (value.isVariantArray())
     {
-        VariantArray variantArray = value.value<VariantArray>();
+        const VariantArray & variantArray = *value.asArray();
         duk_idx_t arr_idx = duk_push_array(m_context);
 
         for (unsigned int i=0; i<variantArray.size(); i++) {
@@ -296,10 +415,10 @@ void DuktapeScriptBackend::pushToDukStack(const Variant & value)
 
     else if (value.isVariantMap())
     {
-        VariantMap variantMap = value.value<VariantMap>();
+        const VariantMap & variantMap = *value.asMap();
         duk_push_object(m_context);
 
-        for (const std::pair<std::string, Variant> & pair : variantMap)
+        for (const auto & pair : variantMap)
         {
             pushToDukStack(pair.second);
             duk_put_prop_string(m_context, -2, pair.first.c_str());
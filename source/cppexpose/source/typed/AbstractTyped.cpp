@@ -18,5 +18,10 @@ AbstractTyped::~AbstractTyped()
 {
 }
 
+bool AbstractTyped::skipsUnchangedValues() const
+{
+    return false;
+}
+
 
 } // namespace cppexpose
@@ -0,0 +1,60 @@
+
+#include <cppexpose/typed/TypeDescriptor.h>
+
+
+namespace cppexpose
+{
+
+
+TypeDescriptor::TypeDescriptor(const std::type_info & type, const std::string & name, size_t size, unsigned int flags,
+                               const TypeDescriptor * elementType, size_t numElements)
+: m_type(type)
+, m_name(name)
+, m_size(size)
+, m_flags(flags)
+, m_elementType(elementType)
+, m_numElements(numElements)
+{
+}
+
+TypeDescriptor::~TypeDescriptor()
+{
+}
+
+const std::type_info & TypeDescriptor::type() const
+{
+    return m_type;
+}
+
+const std::string & TypeDescriptor::name() const
+{
+    return m_name;
+}
+
+size_t TypeDescriptor::size() const
+{
+    return m_size;
+}
+
+unsigned int TypeDescriptor::flags() const
+{
+    return m_flags;
+}
+
+bool TypeDescriptor::is(unsigned int flags) const
+{
+    return (m_flags & flags) == flags;
+}
+
+const TypeDescriptor * TypeDescriptor::elementType() const
+{
+    return m_elementType;
+}
+
+size_t TypeDescriptor::numElements() const
+{
+    return m_numElements;
+}
+
+
+} // namespace cppexpose
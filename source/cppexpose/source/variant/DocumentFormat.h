@@ -0,0 +1,66 @@
+
+#pragma once
+
+
+#include <cstdint>
+#include <cstring>
+
+
+namespace cppexpose
+{
+
+
+/**
+*  @brief
+*    Binary layout of variant documents
+*
+*    A document starts with a header:
+*      char[4]  magic ("CPXD")
+*      uint16   version
+*      uint16   byte order mark (0x0102 in the byte order of the writer)
+*      uint64   offset of the root value
+*
+*    Each value starts at an offset aligned to 8 bytes with a value header:
+*      uint8    type (VariantType)
+*      uint8[7] padding
+*      uint64   payload
+*
+*    The payload contains scalar values (integers as 64 bit, floating point numbers
+*    as double), and the length or number of elements of all other values. It is
+*    followed by the content:
+*      String:       characters, terminated by '\0'
+*      StringVector: offsets of the strings (uint64[n])
+*      VariantArray: offsets of the elements (uint64[n])
+*      VariantMap:   offsets of keys and values (uint64[2 * n]), sorted by key
+*      Packed array: elements in place
+*
+*    All offsets are relative to the beginning of the document. Nested values are
+*    written before the values that contain them.
+*/
+namespace document
+{
+
+
+const char          g_magic[4]        = { 'C', 'P', 'X', 'D' };
+const std::uint16_t g_version         = 1;
+const std::uint16_t g_byteOrderMark   = 0x0102;
+const std::uint64_t g_headerSize      = 16;
+const std::uint64_t g_valueHeaderSize = 16;
+const std::uint64_t g_alignment       = 8;
+
+// Maximum nesting depth of arrays and maps when copying values
+const unsigned int g_maxDepth = 512;
+
+
+inline std::uint64_t readUInt64(const std::uint8_t * data)
+{
+    std::uint64_t value;
+    std::memcpy(&value, data, sizeof(value));
+    return value;
+}
+
+
+} // namespace document
+
+
+} // namespace cppexpose
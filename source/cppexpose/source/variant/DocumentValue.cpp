@@ -0,0 +1,407 @@
+
+#include <cppexpose/variant/DocumentValue.h>
+
+#include <algorithm>
+
+#include "DocumentFormat.h"
+
+
+namespace
+{
+
+
+template <typename T>
+cppexpose::Variant packedArray(const T * data, std::uint64_t count)
+{
+    return cppexpose::Variant(std::vector<T>(data, data + count));
+}
+
+
+} // namespace
+
+
+namespace cppexpose
+{
+
+
+DocumentValue::DocumentValue()
+: m_data(nullptr)
+, m_size(0)
+, m_offset(0)
+, m_payload(0)
+, m_type(VariantType::Null)
+{
+}
+
+DocumentValue::DocumentValue(const std::uint8_t * data, std::uint64_t size, std::uint64_t offset)
+: DocumentValue()
+{
+    // Check position of the value header
+    if (offset % document::g_alignment != 0 || offset < document::g_headerSize ||
+        offset > size || size - offset < document::g_valueHeaderSize)
+    {
+        return;
+    }
+
+    const auto type      = static_cast<VariantType>(data[offset]);
+    const auto payload   = document::readUInt64(data + offset + 8);
+    const auto available = size - offset - document::g_valueHeaderSize;
+    const auto content   = data + offset + document::g_valueHeaderSize;
+
+    // Check that the content is inside the document
+    bool valid = true;
+
+    switch (type)
+    {
+        case VariantType::String:
+            valid = payload < available && content[payload] == '\0';
+            break;
+
+        case VariantType::StringVector:
+        case VariantType::VariantArray:
+            valid = payload <= available / 8;
+            break;
+
+        case VariantType::VariantMap:
+            valid = payload <= available / 16;
+            break;
+
+        case VariantType::FloatVector: valid = payload <= available / sizeof(float);        break;
+        case VariantType::DoubleVector: valid = payload <= available / sizeof(double);      break;
+        case VariantType::Int32Vector: valid = payload <= available / sizeof(std::int32_t); break;
+        case VariantType::Int64Vector: valid = payload <= available / sizeof(std::int64_t); break;
+        case VariantType::UInt8Vector: valid = payload <= available;                        break;
+
+        case VariantType::ObjectPointer:
+        case VariantType::ConstObjectPointer:
+        case VariantType::Other:
+            // Never stored in documents
+            valid = false;
+            break;
+
+        default:
+            valid = type <= VariantType::Double;
+            break;
+    }
+
+    if (valid)
+    {
+        m_data    = data;
+        m_size    = size;
+        m_offset  = offset;
+        m_payload = payload;
+        m_type    = type;
+    }
+}
+
+bool DocumentValue::isNull() const
+{
+    return m_type == VariantType::Null;
+}
+
+VariantType DocumentValue::variantType() const
+{
+    return m_type;
+}
+
+bool DocumentValue::isVariantArray() const
+{
+    return m_type == VariantType::VariantArray;
+}
+
+bool DocumentValue::isVariantMap() const
+{
+    return m_type == VariantType::VariantMap;
+}
+
+bool DocumentValue::isPackedArray() const
+{
+    return m_type >= VariantType::FloatVector && m_type <= VariantType::UInt8Vector;
+}
+
+bool DocumentValue::isString() const
+{
+    return m_type == VariantType::String;
+}
+
+size_t DocumentValue::size() const
+{
+    if (m_type == VariantType::String || m_type == VariantType::StringVector ||
+        m_type == VariantType::VariantArray || m_type == VariantType::VariantMap || isPackedArray())
+    {
+        return static_cast<size_t>(m_payload);
+    }
+
+    return 0;
+}
+
+DocumentValue DocumentValue::at(size_t index) const
+{
+    if (index >= m_payload) {
+        return DocumentValue();
+    }
+
+    const auto position = m_offset + document::g_valueHeaderSize;
+
+    switch (m_type)
+    {
+        case VariantType::StringVector:
+        case VariantType::VariantArray:
+            return valueAt(position + index * 8);
+
+        case VariantType::VariantMap:
+            return valueAt(position + index * 16 + 8);
+
+        default:
+            return DocumentValue();
+    }
+}
+
+DocumentValue DocumentValue::keyAt(size_t index) const
+{
+    if (m_type != VariantType::VariantMap || index >= m_payload) {
+        return DocumentValue();
+    }
+
+    return valueAt(m_offset + document::g_valueHeaderSize + index * 16);
+}
+
+DocumentValue DocumentValue::find(const std::string & key) const
+{
+    return find(key.data(), key.size());
+}
+
+DocumentValue DocumentValue::find(const char * key) const
+{
+    return find(key, std::strlen(key));
+}
+
+DocumentValue DocumentValue::find(const char * key, size_t length) const
+{
+    if (m_type != VariantType::VariantMap) {
+        return DocumentValue();
+    }
+
+    // Binary search over the sorted keys (compared like std::string)
+    size_t first = 0;
+    size_t last  = static_cast<size_t>(m_payload);
+
+    while (first < last)
+    {
+        const size_t middle = first + (last - first) / 2;
+
+        const DocumentValue entry = keyAt(middle);
+        if (!entry.isString()) {
+            return DocumentValue();
+        }
+
+        const size_t entryLength = entry.size();
+
+        int result = std::memcmp(entry.c_str(), key, std::min(entryLength, length));
+        if (result == 0) {
+            result = (entryLength < length) ? -1 : (entryLength > length ? 1 : 0);
+        }
+
+        if (result == 0) {
+            return at(middle);
+        }
+
+        if (result < 0) first = middle + 1;
+        else            last  = middle;
+    }
+
+    return DocumentValue();
+}
+
+const char * DocumentValue::c_str() const
+{
+    return isString() ? reinterpret_cast<const char *>(content()) : nullptr;
+}
+
+bool DocumentValue::toBool() const
+{
+    return toVariant().toBool();
+}
+
+long long DocumentValue::toLongLong() const
+{
+    return toVariant().toLongLong();
+}
+
+unsigned long long DocumentValue::toULongLong() const
+{
+    return toVariant().toULongLong();
+}
+
+double DocumentValue::toDouble() const
+{
+    return toVariant().toDouble();
+}
+
+std::string DocumentValue::toString() const
+{
+    if (isString()) {
+        return std::string(c_str(), size());
+    }
+
+    return toVariant().toString();
+}
+
+Variant DocumentValue::toVariant() const
+{
+    // Each value of a valid document is stored exactly once, so copying never
+    // needs more data than the document contains. This limits the expansion of
+    // corrupted documents that reference the same values multiple times.
+    std::uint64_t budget = m_size;
+
+    Variant value;
+    if (!copyTo(value, 0, budget)) {
+        return Variant();
+    }
+
+    return value;
+}
+
+bool DocumentValue::copyTo(Variant & value, unsigned int depth, std::uint64_t & budget) const
+{
+    if (depth > document::g_maxDepth || !consume(budget)) {
+        return false;
+    }
+
+    const auto integer = static_cast<long long>(m_payload);
+
+    double number;
+    std::memcpy(&number, &m_payload, sizeof(number));
+
+    switch (m_type)
+    {
+        case VariantType::Bool:             value = Variant(m_payload != 0);                                 break;
+        case VariantType::Char:             value = Variant(static_cast<char>(integer));                     break;
+        case VariantType::UnsignedChar:     value = Variant(static_cast<unsigned char>(m_payload));          break;
+        case VariantType::Short:            value = Variant(static_cast<short>(integer));                    break;
+        case VariantType::UnsignedShort:    value = Variant(static_cast<unsigned short>(m_payload));         break;
+        case VariantType::Int:              value = Variant(static_cast<int>(integer));                      break;
+        case VariantType::UnsignedInt:      value = Variant(static_cast<unsigned int>(m_payload));           break;
+        case VariantType::Long:             value = Variant(static_cast<long>(integer));                     break;
+        case VariantType::UnsignedLong:     value = Variant(static_cast<unsigned long>(m_payload));          break;
+        case VariantType::LongLong:         value = Variant(integer);                                        break;
+        case VariantType::UnsignedLongLong: value = Variant(static_cast<unsigned long long>(m_payload));     break;
+        case VariantType::Float:            value = Variant(static_cast<float>(number));                     break;
+        case VariantType::Double:           value = Variant(number);                                         break;
+        case VariantType::String:           value = Variant(std::string(c_str(), size()));                   break;
+
+        case VariantType::StringVector:
+        {
+            std::vector<std::string> strings;
+            strings.reserve(size());
+
+            for (size_t i = 0; i < size(); ++i)
+            {
+                const DocumentValue str = at(i);
+                if (!str.consume(budget)) {
+                    return false;
+                }
+
+                strings.push_back(str.toString());
+            }
+
+            value = Variant(std::move(strings));
+            break;
+        }
+
+        case VariantType::VariantArray:
+        {
+            VariantArray array;
+            array.reserve(size());
+
+            for (size_t i = 0; i < size(); ++i)
+            {
+                array.emplace_back();
+                if (!at(i).copyTo(array.back(), depth + 1, budget)) {
+                    return false;
+                }
+            }
+
+            value = Variant(std::move(array));
+            break;
+        }
+
+        case VariantType::VariantMap:
+        {
+            VariantMap map;
+
+            for (size_t i = 0; i < size(); ++i)
+            {
+                const DocumentValue key = keyAt(i);
+                if (!key.consume(budget)) {
+                    return false;
+                }
+
+                if (key.isString() && !at(i).copyTo(map[std::string(key.c_str(), key.size())], depth + 1, budget)) {
+                    return false;
+                }
+            }
+
+            value = Variant(std::move(map));
+            break;
+        }
+
+        case VariantType::FloatVector:  value = packedArray(data<float>(), m_payload);        break;
+        case VariantType::DoubleVector: value = packedArray(data<double>(), m_payload);       break;
+        case VariantType::Int32Vector:  value = packedArray(data<std::int32_t>(), m_payload); break;
+        case VariantType::Int64Vector:  value = packedArray(data<std::int64_t>(), m_payload); break;
+        case VariantType::UInt8Vector:  value = packedArray(data<std::uint8_t>(), m_payload); break;
+
+        default:
+            value = Variant();
+            break;
+    }
+
+    return true;
+}
+
+DocumentValue DocumentValue::valueAt(std::uint64_t position) const
+{
+    const auto offset = document::readUInt64(m_data + position);
+
+    // Nested values are always stored before their parent, which also rules out cycles
+    if (offset >= m_offset) {
+        return DocumentValue();
+    }
+
+    return DocumentValue(m_data, m_size, offset);
+}
+
+bool DocumentValue::consume(std::uint64_t & budget) const
+{
+    std::uint64_t size = document::g_valueHeaderSize;
+
+    switch (m_type)
+    {
+        case VariantType::String:       size += m_payload + 1;                     break;
+        case VariantType::StringVector: size += m_payload * 8;                     break;
+        case VariantType::VariantArray: size += m_payload * 8;                     break;
+        case VariantType::VariantMap:   size += m_payload * 16;                    break;
+        case VariantType::FloatVector:  size += m_payload * sizeof(float);         break;
+        case VariantType::DoubleVector: size += m_payload * sizeof(double);        break;
+        case VariantType::Int32Vector:  size += m_payload * sizeof(std::int32_t);  break;
+        case VariantType::Int64Vector:  size += m_payload * sizeof(std::int64_t);  break;
+        case VariantType::UInt8Vector:  size += m_payload;                         break;
+        default:                                                                   break;
+    }
+
+    if (size > budget) {
+        return false;
+    }
+
+    budget -= size;
+    return true;
+}
+
+const std::uint8_t * DocumentValue::content() const
+{
+    return m_data + m_offset + document::g_valueHeaderSize;
+}
+
+
+} // namespace cppexpose
@@ -1,169 +1,665 @@
 
 #include <cppexpose/variant/Variant.h>
 
+#include <atomic>
+#include <cmath>
+#include <limits>
+#include <cstring>
+#include <algorithm>
+
 #include <cppexpose/json/JSON.h>
 #include <cppexpose/typed/DirectValue.h>
 
 
+namespace
+{
+
+
+bool isIntegralType(cppexpose::VariantType type)
+{
+    return type >= cppexpose::VariantType::Char && type <= cppexpose::VariantType::UnsignedLongLong;
+}
+
+bool isUnsignedIntegralType(cppexpose::VariantType type)
+{
+    switch (type)
+    {
+        case cppexpose::VariantType::Char:
+            return std::is_unsigned<char>::value;
+
+        case cppexpose::VariantType::UnsignedChar:
+        case cppexpose::VariantType::UnsignedShort:
+        case cppexpose::VariantType::UnsignedInt:
+        case cppexpose::VariantType::UnsignedLong:
+        case cppexpose::VariantType::UnsignedLongLong:
+            return true;
+
+        default:
+            return false;
+    }
+}
+
+bool isFloatingPointType(cppexpose::VariantType type)
+{
+    return type == cppexpose::VariantType::Float || type == cppexpose::VariantType::Double;
+}
+
+// 64 bit FNV-1a hash, values are hashed byte-wise in a fixed order
+const std::uint64_t g_hashOffset = 14695981039346656037ull;
+const std::uint64_t g_hashPrime  = 1099511628211ull;
+
+void hashInteger(std::uint64_t & hash, std::uint64_t value)
+{
+    for (int i = 0; i < 8; ++i)
+    {
+        hash ^= (value >> (i * 8)) & 0xffu;
+        hash *= g_hashPrime;
+    }
+}
+
+void hashNumber(std::uint64_t & hash, long long value)
+{
+    hashInteger(hash, static_cast<std::uint64_t>(value));
+}
+
+void hashNumber(std::uint64_t & hash, unsigned long long value)
+{
+    hashInteger(hash, static_cast<std::uint64_t>(value));
+}
+
+void hashNumber(std::uint64_t & hash, double value)
+{
+    // -0.0 and 0.0 are equal, so they must have the same hash value
+    if (value == 0.0) {
+        value = 0.0;
+    }
+
+    // All NaNs are equal (see equalNumbers()), regardless of sign and payload
+    if (std::isnan(value)) {
+        value = std::numeric_limits<double>::quiet_NaN();
+    }
+
+    std::uint64_t bits;
+    std::memcpy(&bits, &value, sizeof(bits));
+    hashInteger(hash, bits);
+}
+
+void hashNumber(std::uint64_t & hash, float value)
+{
+    hashNumber(hash, static_cast<double>(value));
+}
+
+void hashNumber(std::uint64_t & hash, std::int32_t value)
+{
+    hashNumber(hash, static_cast<long long>(value));
+}
+
+void hashNumber(std::uint64_t & hash, std::int64_t value)
+{
+    hashNumber(hash, static_cast<long long>(value));
+}
+
+void hashNumber(std::uint64_t & hash, std::uint8_t value)
+{
+    hashNumber(hash, static_cast<unsigned long long>(value));
+}
+
+void hashString(std::uint64_t & hash, const std::string & str)
+{
+    hashInteger(hash, str.size());
+
+    for (const char c : str)
+    {
+        hash ^= static_cast<unsigned char>(c);
+        hash *= g_hashPrime;
+    }
+}
+
+template <typename T>
+void hashNumbers(std::uint64_t & hash, const std::vector<T> & values)
+{
+    hashInteger(hash, values.size());
+
+    for (const T value : values)
+    {
+        hashNumber(hash, value);
+    }
+}
+
+template <typename T>
+bool equalNumbers(T a, T b)
+{
+    // NaNs are considered equal, so that equality is consistent with the hash value
+    return a == b || (std::isnan(a) && std::isnan(b));
+}
+
+template <typename T>
+bool equalNumbers(const std::vector<T> & a, const std::vector<T> & b)
+{
+    return a.size() == b.size() && std::equal(a.begin(), a.end(), b.begin(), [] (T x, T y)
+    {
+        return equalNumbers(x, y);
+    });
+}
+
+template <typename Map>
+bool equalMaps(const Map & a, const Map & b)
+{
+    return a.size() == b.size() && std::equal(a.begin(), a.end(), b.begin());
+}
+
+
+} // namespace
+
+
 namespace cppexpose
 {
 
 
+template <typename T>
+struct Variant::SharedValue
+{
+    /**
+    *  @brief
+    *    Reference counted value
+    */
+    class Value : public DirectValue<T>
+    {
+    public:
+        Value(const T & value)
+        : DirectValue<T>(value)
+        , m_refCount(1)
+        , m_hash(0)
+        {
+        }
+
+        Value(T && value)
+        : DirectValue<T>(std::move(value))
+        , m_refCount(1)
+        , m_hash(0)
+        {
+        }
+
+    public:
+        mutable std::atomic<unsigned int>  m_refCount; ///< Number of variants that reference the value
+        mutable std::atomic<std::uint64_t> m_hash;     ///< Cached hash value (0 if not computed)
+    };
+
+    static void share(Variant & variant)
+    {
+        T * data = static_cast<DirectValue<T> *>(variant.m_value)->ptr();
+        AbstractTyped * value = new Value(std::move(*data));
+
+        variant.destroyValue();
+        variant.m_value     = value;
+        variant.m_functions = &functions;
+        variant.m_type      = VariantTypeOf<T>::value;
+    }
+
+    static void copy(Variant & target, const Variant & source)
+    {
+        static_cast<const Value *>(source.m_value)->m_refCount.fetch_add(1, std::memory_order_relaxed);
+
+        target.m_value     = source.m_value;
+        target.m_functions = source.m_functions;
+        target.m_type      = source.m_type;
+    }
+
+    static void destroy(AbstractTyped * value)
+    {
+        if (static_cast<Value *>(value)->m_refCount.fetch_sub(1, std::memory_order_acq_rel) == 1) {
+            delete value;
+        }
+    }
+
+    static AbstractTyped * detach(AbstractTyped * value)
+    {
+        auto shared = static_cast<Value *>(value);
+
+        // Value is only referenced by this variant, and is about to be modified
+        if (shared->m_refCount.load(std::memory_order_acquire) == 1) {
+            shared->m_hash.store(0, std::memory_order_relaxed);
+            return value;
+        }
+
+        // Create own copy of the data
+        AbstractTyped * copy = new Value(*shared->ptr());
+        destroy(value);
+        return copy;
+    }
+
+    static std::atomic<std::uint64_t> * hashCache(const Variant & variant)
+    {
+        return &static_cast<const Value *>(variant.m_value)->m_hash;
+    }
+
+    static const ValueFunctions functions;
+};
+
+template <typename T>
+const Variant::ValueFunctions Variant::SharedValue<T>::functions =
+{
+    &Variant::SharedValue<T>::copy,
+    nullptr,
+    &Variant::SharedValue<T>::destroy,
+    &Variant::SharedValue<T>::detach
+};
+
+
 Variant Variant::array()
 {
     Variant variant;
-    variant.m_value = cppassist::make_unique<DirectValue<VariantArray>>(VariantArray());
+    variant.initValue<VariantArray>(VariantArray());
     return variant;
 }
 
 Variant Variant::array(size_t count)
 {
     Variant variant;
-    variant.m_value = cppassist::make_unique<DirectValue<VariantArray>>(VariantArray(count));
+    variant.initValue<VariantArray>(VariantArray(count));
     return variant;
 }
 
 Variant Variant::map()
 {
     Variant variant;
-    variant.m_value = cppassist::make_unique<DirectValue<VariantMap>>(VariantMap());
+    variant.initValue<VariantMap>(VariantMap());
     return variant;
 }
 
 Variant::Variant()
 : m_value(nullptr)
+, m_functions(nullptr)
+, m_type(VariantType::Null)
 {
 }
 
 Variant::Variant(const Variant & variant)
-: m_value(variant.m_value ? variant.m_value->clone() : nullptr)
+: m_value(nullptr)
+, m_functions(nullptr)
+, m_type(VariantType::Null)
+{
+    copyValue(variant);
+}
+
+Variant::Variant(Variant && variant) CPPEXPOSE_NOEXCEPT
+: m_value(nullptr)
+, m_functions(nullptr)
+, m_type(VariantType::Null)
 {
+    moveValue(variant);
 }
 
 Variant::Variant(bool value)
-: m_value(cppassist::make_unique<DirectValue<bool>>(value))
+: m_value(nullptr)
+, m_functions(nullptr)
+, m_type(VariantType::Null)
 {
+    initValue<bool>(value);
 }
 
 Variant::Variant(char value)
-: m_value(cppassist::make_unique<DirectValue<char>>(value))
+: m_value(nullptr)
+, m_functions(nullptr)
+, m_type(VariantType::Null)
 {
+    initValue<char>(value);
 }
 
 Variant::Variant(unsigned char value)
-: m_value(cppassist::make_unique<DirectValue<unsigned char>>(value))
+: m_value(nullptr)
+, m_functions(nullptr)
+, m_type(VariantType::Null)
 {
+    initValue<unsigned char>(value);
 }
 
 Variant::Variant(short value)
-: m_value(cppassist::make_unique<DirectValue<short>>(value))
+: m_value(nullptr)
+, m_functions(nullptr)
+, m_type(VariantType::Null)
 {
+    initValue<short>(value);
 }
 
 Variant::Variant(unsigned short value)
-: m_value(cppassist::make_unique<DirectValue<unsigned short>>(value))
+: m_value(nullptr)
+, m_functions(nullptr)
+, m_type(VariantType::Null)
 {
+    initValue<unsigned short>(value);
 }
 
 Variant::Variant(int value)
-: m_value(cppassist::make_unique<DirectValue<int>>(value))
+: m_value(nullptr)
+, m_functions(nullptr)
+, m_type(VariantType::Null)
 {
+    initValue<int>(value);
 }
 
 Variant::Variant(unsigned int value)
-: m_value(cppassist::make_unique<DirectValue<unsigned int>>(value))
+: m_value(nullptr)
+, m_functions(nullptr)
+, m_type(VariantType::Null)
 {
+    initValue<unsigned int>(value);
 }
 
 Variant::Variant(long value)
-: m_value(cppassist::make_unique<DirectValue<long>>(value))
+: m_value(nullptr)
+, m_functions(nullptr)
+, m_type(VariantType::Null)
 {
+    initValue<long>(value);
 }
 
 Variant::Variant(unsigned long value)
-: m_value(cppassist::make_unique<DirectValue<unsigned long>>(value))
+: m_value(nullptr)
+, m_functions(nullptr)
+, m_type(VariantType::Null)
 {
+    initValue<unsigned long>(value);
 }
 
 Variant::Variant(long long value)
-: m_value(cppassist::make_unique<DirectValue<long long>>(value))
+: m_value(nullptr)
+, m_functions(nullptr)
+, m_type(VariantType::Null)
 {
+    initValue<long long>(value);
 }
 
 Variant::Variant(unsigned long long value)
-: m_value(cppassist::make_unique<DirectValue<unsigned long long>>(value))
+: m_value(nullptr)
+, m_functions(nullptr)
+, m_type(VariantType::Null)
 {
+    initValue<unsigned long long>(value);
 }
 
 Variant::Variant(float value)
-: m_value(cppassist::make_unique<DirectValue<float>>(value))
+: m_value(nullptr)
+, m_functions(nullptr)
+, m_type(VariantType::Null)
 {
+    initValue<float>(value);
 }
 
 Variant::Variant(double value)
-: m_value(cppassist::make_unique<DirectValue<double>>(value))
+: m_value(nullptr)
+, m_functions(nullptr)
+, m_type(VariantType::Null)
 {
+    initValue<double>(value);
 }
 
 Variant::Variant(const char * value)
-: m_value(cppassist::make_unique<DirectValue<std::string>>(std::string(value)))
+: m_value(nullptr)
+, m_functions(nullptr)
+, m_type(VariantType::Null)
 {
+    initValue<std::string>(std::string(value));
 }
 
 Variant::Variant(const std::string & value)
-: m_value(cppassist::make_unique<DirectValue<std::string>>(value))
+: m_value(nullptr)
+, m_functions(nullptr)
+, m_type(VariantType::Null)
 {
+    initValue<std::string>(value);
 }
 
 Variant::Variant(const std::vector<std::string> & value)
-: m_value(cppassist::make_unique<DirectValue< std::vector<std::string> >>(value))
+: m_value(nullptr)
+, m_functions(nullptr)
+, m_type(VariantType::Null)
 {
+    initValue<std::vector<std::string>>(value);
 }
 
 Variant::Variant(const VariantArray & array)
-: m_value(cppassist::make_unique<DirectValue<VariantArray>>(array))
+: m_value(nullptr)
+, m_functions(nullptr)
+, m_type(VariantType::Null)
 {
+    initValue<VariantArray>(array);
 }
 
 Variant::Variant(const VariantMap & map)
-: m_value(cppassist::make_unique<DirectValue<VariantMap>>(map))
+: m_value(nullptr)
+, m_functions(nullptr)
+, m_type(VariantType::Null)
 {
+    initValue<VariantMap>(map);
 }
 
 Variant::Variant(const Object * obj)
-: m_value(cppassist::make_unique<DirectValue<const Object *>>(obj))
+: m_value(nullptr)
+, m_functions(nullptr)
+, m_type(VariantType::Null)
 {
+    initValue<const Object *>(obj);
 }
 
 Variant::Variant(Object * obj)
-: m_value(cppassist::make_unique<DirectValue<Object *>>(obj))
+: m_value(nullptr)
+, m_functions(nullptr)
+, m_type(VariantType::Null)
+{
+    initValue<Object *>(obj);
+}
+
+Variant::Variant(std::string && value)
+: m_value(nullptr)
+, m_functions(nullptr)
+, m_type(VariantType::Null)
+{
+    initValue<std::string>(std::move(value));
+}
+
+Variant::Variant(VariantArray && array)
+: m_value(nullptr)
+, m_functions(nullptr)
+, m_type(VariantType::Null)
+{
+    initValue<VariantArray>(std::move(array));
+}
+
+Variant::Variant(VariantMap && map)
+: m_value(nullptr)
+, m_functions(nullptr)
+, m_type(VariantType::Null)
+{
+    initValue<VariantMap>(std::move(map));
+}
+
+Variant::Variant(const std::vector<float> & values)
+: m_value(nullptr)
+, m_functions(nullptr)
+, m_type(VariantType::Null)
+{
+    initValue<std::vector<float>>(values);
+}
+
+Variant::Variant(const std::vector<double> & values)
+: m_value(nullptr)
+, m_functions(nullptr)
+, m_type(VariantType::Null)
+{
+    initValue<std::vector<double>>(values);
+}
+
+Variant::Variant(const std::vector<std::int32_t> & values)
+: m_value(nullptr)
+, m_functions(nullptr)
+, m_type(VariantType::Null)
+{
+    initValue<std::vector<std::int32_t>>(values);
+}
+
+Variant::Variant(const std::vector<std::int64_t> & values)
+: m_value(nullptr)
+, m_functions(nullptr)
+, m_type(VariantType::Null)
+{
+    initValue<std::vector<std::int64_t>>(values);
+}
+
+Variant::Variant(const std::vector<std::uint8_t> & values)
+: m_value(nullptr)
+, m_functions(nullptr)
+, m_type(VariantType::Null)
+{
+    initValue<std::vector<std::uint8_t>>(values);
+}
+
+Variant::Variant(std::vector<float> && values)
+: m_value(nullptr)
+, m_functions(nullptr)
+, m_type(VariantType::Null)
+{
+    initValue<std::vector<float>>(std::move(values));
+}
+
+Variant::Variant(std::vector<double> && values)
+: m_value(nullptr)
+, m_functions(nullptr)
+, m_type(VariantType::Null)
+{
+    initValue<std::vector<double>>(std::move(values));
+}
+
+Variant::Variant(std::vector<std::int32_t> && values)
+: m_value(nullptr)
+, m_functions(nullptr)
+, m_type(VariantType::Null)
+{
+    initValue<std::vector<std::int32_t>>(std::move(values));
+}
+
+Variant::Variant(std::vector<std::int64_t> && values)
+: m_value(nullptr)
+, m_functions(nullptr)
+, m_type(VariantType::Null)
+{
+    initValue<std::vector<std::int64_t>>(std::move(values));
+}
+
+Variant::Variant(std::vector<std::uint8_t> && values)
+: m_value(nullptr)
+, m_functions(nullptr)
+, m_type(VariantType::Null)
 {
+    initValue<std::vector<std::uint8_t>>(std::move(values));
 }
 
 Variant::~Variant()
 {
+    destroyValue();
 }
 
 Variant & Variant::operator=(const Variant & variant)
 {
-    m_value = variant.m_value ? variant.m_value->clone() : nullptr;
+    if (&variant != this)
+    {
+        destroyValue();
+        copyValue(variant);
+    }
+
+    return *this;
+}
+
+Variant & Variant::operator=(Variant && variant) CPPEXPOSE_NOEXCEPT
+{
+    if (&variant != this)
+    {
+        destroyValue();
+        moveValue(variant);
+    }
 
     return *this;
 }
 
+bool Variant::operator==(const Variant & variant) const
+{
+    if (m_type != variant.m_type) {
+        return false;
+    }
+
+    // Same shared data, or both empty
+    if (m_value == variant.m_value) {
+        return true;
+    }
+
+    // Different cached hash values
+    const auto cache      = hashCache();
+    const auto otherCache = variant.hashCache();
+
+    if (cache && otherCache)
+    {
+        const std::uint64_t hash      = cache->load(std::memory_order_relaxed);
+        const std::uint64_t otherHash = otherCache->load(std::memory_order_relaxed);
+
+        if (hash != 0 && otherHash != 0 && hash != otherHash) {
+            return false;
+        }
+    }
+
+    switch (m_type)
+    {
+        case VariantType::Bool:               return data<bool>() == variant.data<bool>();
+        case VariantType::Char:               return data<char>() == variant.data<char>();
+        case VariantType::UnsignedChar:       return data<unsigned char>() == variant.data<unsigned char>();
+        case VariantType::Short:              return data<short>() == variant.data<short>();
+        case VariantType::UnsignedShort:      return data<unsigned short>() == variant.data<unsigned short>();
+        case VariantType::Int:                return data<int>() == variant.data<int>();
+        case VariantType::UnsignedInt:        return data<unsigned int>() == variant.data<unsigned int>();
+        case VariantType::Long:               return data<long>() == variant.data<long>();
+        case VariantType::UnsignedLong:       return data<unsigned long>() == variant.data<unsigned long>();
+        case VariantType::LongLong:           return data<long long>() == variant.data<long long>();
+        case VariantType::UnsignedLongLong:   return data<unsigned long long>() == variant.data<unsigned long long>();
+        case VariantType::Float:              return equalNumbers(data<float>(), variant.data<float>());
+        case VariantType::Double:             return equalNumbers(data<double>(), variant.data<double>());
+        case VariantType::String:             return data<std::string>() == variant.data<std::string>();
+        case VariantType::StringVector:       return data<std::vector<std::string>>() == variant.data<std::vector<std::string>>();
+        case VariantType::VariantArray:       return data<VariantArray>() == variant.data<VariantArray>();
+        case VariantType::VariantMap:         return equalMaps(data<VariantMap>(), variant.data<VariantMap>());
+        case VariantType::ObjectPointer:      return data<Object *>() == variant.data<Object *>();
+        case VariantType::ConstObjectPointer: return data<const Object *>() == variant.data<const Object *>();
+        case VariantType::FloatVector:        return equalNumbers(data<std::vector<float>>(), variant.data<std::vector<float>>());
+        case VariantType::DoubleVector:       return equalNumbers(data<std::vector<double>>(), variant.data<std::vector<double>>());
+        case VariantType::Int32Vector:        return data<std::vector<std::int32_t>>() == variant.data<std::vector<std::int32_t>>();
+        case VariantType::Int64Vector:        return data<std::vector<std::int64_t>>() == variant.data<std::vector<std::int64_t>>();
+        case VariantType::UInt8Vector:        return data<std::vector<std::uint8_t>>() == variant.data<std::vector<std::uint8_t>>();
+        case VariantType::Other:              return type() == variant.type() && toString() == variant.toString();
+        default:                              return false;
+    }
+}
+
+bool Variant::operator!=(const Variant & variant) const
+{
+    return !(*this == variant);
+}
+
 bool Variant::isNull() const
 {
-    return !m_value;
+    return m_type == VariantType::Null;
 }
 
 bool Variant::isVariantArray() const
 {
-    return hasType<VariantArray>();
+    return m_type == VariantType::VariantArray;
 }
 
 bool Variant::isVariantMap() const
 {
-    return hasType<VariantMap>();
+    return m_type == VariantType::VariantMap;
+}
+
+bool Variant::isPackedArray() const
+{
+    return m_type >= VariantType::FloatVector && m_type <= VariantType::UInt8Vector;
 }
 
 const std::type_info & Variant::type() const
@@ -175,6 +671,11 @@ const std::type_info & Variant::type() const
     }
 }
 
+VariantType Variant::variantType() const
+{
+    return m_type;
+}
+
 VariantArray * Variant::asArray()
 {
     return ptr<VariantArray>();
@@ -195,6 +696,46 @@ const VariantMap * Variant::asMap() const
     return ptr<VariantMap>();
 }
 
+void Variant::share()
+{
+    // Already shared values are not affected
+    if (isShared()) {
+        return;
+    }
+
+    if (hasType<VariantArray>()) {
+        SharedValue<VariantArray>::share(*this);
+    } else if (hasType<VariantMap>()) {
+        SharedValue<VariantMap>::share(*this);
+    }
+}
+
+bool Variant::isShared() const
+{
+    return m_functions && m_functions->detach;
+}
+
+std::uint64_t Variant::hash() const
+{
+    const auto cache = hashCache();
+
+    if (cache)
+    {
+        const std::uint64_t hash = cache->load(std::memory_order_relaxed);
+        if (hash != 0) {
+            return hash;
+        }
+    }
+
+    const std::uint64_t hash = computeHash();
+
+    if (cache) {
+        cache->store(hash, std::memory_order_relaxed);
+    }
+
+    return hash;
+}
+
 std::string Variant::toJSON(JSON::OutputMode outputMode) const
 {
     return JSON::stringify(*this, outputMode);
@@ -202,62 +743,63 @@ std::string Variant::toJSON(JSON::OutputMode outputMode) const
 
 bool Variant::isEnum() const
 {
-    if (m_value) return m_value->isEnum();
-    else         return false;
+    if (m_type == VariantType::Other) return m_value->isEnum();
+    else                              return false;
 }
 
 bool Variant::isArray() const
 {
-    if (m_value) return m_value->isArray();
-    else         return false;
+    // Tagged containers (e.g., packed arrays) are arrays if their typed value is
+    if (isScalar()) return false;
+    else            return m_value && m_value->isArray();
 }
 
 bool Variant::isVariant() const
 {
-    if (m_value) return m_value->isVariant();
-    else         return false;
+    if (m_type == VariantType::Other) return m_value->isVariant();
+    else                              return false;
 }
 
 bool Variant::isString() const
 {
-    if (m_value) return m_value->isString();
-    else         return false;
+    if (m_type == VariantType::Other) return m_value->isString();
+    else                              return m_type == VariantType::String;
 }
 
 bool Variant::isBool() const
 {
-    if (m_value) return m_value->isBool();
-    else         return false;
+    if (m_type == VariantType::Other) return m_value->isBool();
+    else                              return m_type == VariantType::Bool;
 }
 
 bool Variant::isNumber() const
 {
-    if (m_value) return m_value->isNumber();
-    else         return false;
+    if (m_type == VariantType::Other) return m_value->isNumber();
+    else                              return isIntegralType(m_type) || isFloatingPointType(m_type);
 }
 
 bool Variant::isIntegral() const
 {
-    if (m_value) return m_value->isIntegral();
-    else         return false;
+    if (m_type == VariantType::Other) return m_value->isIntegral();
+    else                              return isIntegralType(m_type);
 }
 
 bool Variant::isSignedIntegral() const
 {
-    if (m_value) return m_value->isSignedIntegral();
-    else         return false;
+    if (m_type == VariantType::Other) return m_value->isSignedIntegral();
+    else                              return isIntegralType(m_type) && !isUnsignedIntegralType(m_type);
 }
 
 bool Variant::isUnsignedIntegral() const
 {
-    if (m_value) return m_value->isUnsignedIntegral();
-    else         return false;
+    if (m_type == VariantType::Other) return m_value->isUnsignedIntegral();
+    else                              return isUnsignedIntegralType(m_type);
 }
 
 bool Variant::isFloatingPoint() const
 {
-    if (m_value) return m_value->isFloatingPoint();
-    else         return false;
+    if (m_type == VariantType::Other) return m_value->isFloatingPoint();
+    else                              return isFloatingPointType(m_type);
 }
 
 Variant Variant::toVariant() const
@@ -268,13 +810,20 @@ Variant Variant::toVariant() const
 
 bool Variant::fromVariant(const Variant & value)
 {
+    detach();
+
     if (m_value) return m_value->fromVariant(value);
     else         return false;
 }
 
 std::string Variant::toString() const
 {
-    if (isVariantMap() || isVariantArray())
+    if (isScalar())
+    {
+        return convertScalar<std::string>();
+    }
+
+    else if (isVariantMap() || isVariantArray() || isPackedArray())
     {
         return toJSON();
     }
@@ -290,57 +839,230 @@ std::string Variant::toString() const
 
 bool Variant::fromString(const std::string & value)
 {
+    detach();
+
     if (m_value) return m_value->fromString(value);
     else         return false;
 }
 
 bool Variant::toBool() const
 {
-    if (m_value) return m_value->toBool();
-    else         return false;
+    if (isScalar())   return convertScalar<bool>();
+    else if (m_value) return m_value->toBool();
+    else              return false;
 }
 
 bool Variant::fromBool(bool value)
 {
+    detach();
+
     if (m_value) return m_value->fromBool(value);
     else         return false;
 }
 
 long long Variant::toLongLong() const
 {
-    if (m_value) return m_value->toLongLong();
-    else         return 0ll;
+    if (isScalar())   return convertScalar<long long>();
+    else if (m_value) return m_value->toLongLong();
+    else              return 0ll;
 }
 
 bool Variant::fromLongLong(long long value)
 {
+    detach();
+
     if (m_value) return m_value->fromLongLong(value);
     else         return false;
 }
 
 unsigned long long Variant::toULongLong() const
 {
-    if (m_value) return m_value->toULongLong();
-    else         return 0ull;
+    if (isScalar())   return convertScalar<unsigned long long>();
+    else if (m_value) return m_value->toULongLong();
+    else              return 0ull;
 }
 
 bool Variant::fromULongLong(unsigned long long value)
 {
+    detach();
+
     if (m_value) return m_value->fromULongLong(value);
     else         return false;
 }
 
 double Variant::toDouble() const
 {
-    if (m_value) return m_value->toDouble();
-    else         return 0.0;
+    if (isScalar())   return convertScalar<double>();
+    else if (m_value) return m_value->toDouble();
+    else              return 0.0;
 }
 
 bool Variant::fromDouble(double value)
 {
+    detach();
+
     if (m_value) return m_value->fromDouble(value);
     else         return false;
 }
 
 
+bool Variant::isScalar() const
+{
+    return m_type >= VariantType::Bool && m_type <= VariantType::String;
+}
+
+std::atomic<std::uint64_t> * Variant::hashCache() const
+{
+    if (!isShared()) {
+        return nullptr;
+    }
+
+    if (m_type == VariantType::VariantArray) return SharedValue<VariantArray>::hashCache(*this);
+    else                                     return SharedValue<VariantMap>::hashCache(*this);
+}
+
+std::uint64_t Variant::computeHash() const
+{
+    std::uint64_t hash = g_hashOffset;
+    hashInteger(hash, static_cast<std::uint64_t>(m_type));
+
+    switch (m_type)
+    {
+        case VariantType::Bool:               hashNumber(hash, data<bool>() ? 1ull : 0ull); break;
+        case VariantType::Char:               hashNumber(hash, static_cast<long long>(data<char>())); break;
+        case VariantType::UnsignedChar:       hashNumber(hash, static_cast<unsigned long long>(data<unsigned char>())); break;
+        case VariantType::Short:              hashNumber(hash, static_cast<long long>(data<short>())); break;
+        case VariantType::UnsignedShort:      hashNumber(hash, static_cast<unsigned long long>(data<unsigned short>())); break;
+        case VariantType::Int:                hashNumber(hash, static_cast<long long>(data<int>())); break;
+        case VariantType::UnsignedInt:        hashNumber(hash, static_cast<unsigned long long>(data<unsigned int>())); break;
+        case VariantType::Long:               hashNumber(hash, static_cast<long long>(data<long>())); break;
+        case VariantType::UnsignedLong:       hashNumber(hash, static_cast<unsigned long long>(data<unsigned long>())); break;
+        case VariantType::LongLong:           hashNumber(hash, data<long long>()); break;
+        case VariantType::UnsignedLongLong:   hashNumber(hash, data<unsigned long long>()); break;
+        case VariantType::Float:              hashNumber(hash, data<float>()); break;
+        case VariantType::Double:             hashNumber(hash, data<double>()); break;
+        case VariantType::String:             hashString(hash, data<std::string>()); break;
+        case VariantType::FloatVector:        hashNumbers(hash, data<std::vector<float>>()); break;
+        case VariantType::DoubleVector:       hashNumbers(hash, data<std::vector<double>>()); break;
+        case VariantType::Int32Vector:        hashNumbers(hash, data<std::vector<std::int32_t>>()); break;
+        case VariantType::Int64Vector:        hashNumbers(hash, data<std::vector<std::int64_t>>()); break;
+        case VariantType::UInt8Vector:        hashNumbers(hash, data<std::vector<std::uint8_t>>()); break;
+        case VariantType::ObjectPointer:      hashInteger(hash, reinterpret_cast<std::uintptr_t>(data<Object *>())); break;
+        case VariantType::ConstObjectPointer: hashInteger(hash, reinterpret_cast<std::uintptr_t>(data<const Object *>())); break;
+
+        case VariantType::StringVector:
+        {
+            const auto & strings = data<std::vector<std::string>>();
+            hashInteger(hash, strings.size());
+
+            for (const auto & str : strings) {
+                hashString(hash, str);
+            }
+
+            break;
+        }
+
+        case VariantType::VariantArray:
+        {
+            const auto & array = data<VariantArray>();
+            hashInteger(hash, array.size());
+
+            // Elements use their own (possibly cached) hash values
+            for (const auto & element : array) {
+                hashInteger(hash, element.hash());
+            }
+
+            break;
+        }
+
+        case VariantType::VariantMap:
+        {
+            const auto & map = data<VariantMap>();
+            hashInteger(hash, map.size());
+
+            for (const auto & it : map)
+            {
+                hashString(hash, it.first);
+                hashInteger(hash, it.second.hash());
+            }
+
+            break;
+        }
+
+        case VariantType::Other:
+            hashString(hash, type().name());
+            hashString(hash, toString());
+            break;
+
+        default:
+            break;
+    }
+
+    return hash;
+}
+
+void Variant::copyValue(const Variant & variant)
+{
+    if (!variant.m_value) {
+        return;
+    }
+
+    if (variant.m_functions)
+    {
+        variant.m_functions->copy(*this, variant);
+    }
+
+    else
+    {
+        m_value = variant.m_value->clone().release();
+        m_type  = variant.m_type;
+    }
+}
+
+void Variant::moveValue(Variant & variant) CPPEXPOSE_NOEXCEPT
+{
+    if (!variant.m_value) {
+        return;
+    }
+
+    // Inline values are moved into the own storage
+    if (variant.m_functions && variant.m_functions->move)
+    {
+        variant.m_functions->move(*this, variant);
+        variant.destroyValue();
+    }
+
+    // Values on the heap are simply taken over
+    else
+    {
+        m_value     = variant.m_value;
+        m_functions = variant.m_functions;
+        m_type      = variant.m_type;
+
+        variant.m_value     = nullptr;
+        variant.m_functions = nullptr;
+        variant.m_type      = VariantType::Null;
+    }
+}
+
+void Variant::destroyValue() CPPEXPOSE_NOEXCEPT
+{
+    if (m_functions) {
+        m_functions->destroy(m_value);
+    } else {
+        delete m_value;
+    }
+
+    m_value     = nullptr;
+    m_functions = nullptr;
+    m_type      = VariantType::Null;
+}
+
+void Variant::detach()
+{
+    if (m_functions && m_functions->detach) {
+        m_value = m_functions->detach(m_value);
+    }
+}
+
 } // namespace cppexpose
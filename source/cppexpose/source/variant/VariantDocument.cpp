@@ -0,0 +1,491 @@
+
+#include <cppexpose/variant/VariantDocument.h>
+
+#include <fstream>
+#include <limits>
+
+#ifdef _WIN32
+    #ifndef NOMINMAX
+        #define NOMINMAX
+    #endif
+    #include <windows.h>
+#else
+    #include <fcntl.h>
+    #include <sys/mman.h>
+    #include <sys/stat.h>
+    #include <unistd.h>
+#endif
+
+#include <cppassist/logging/logging.h>
+
+#include "DocumentFormat.h"
+
+
+using namespace cppexpose;
+
+
+namespace
+{
+
+
+/**
+*  @brief
+*    Output into a buffer
+*/
+class BufferWriter
+{
+public:
+    explicit BufferWriter(std::vector<std::uint8_t> & buffer)
+    : m_buffer(buffer)
+    {
+    }
+
+    void write(const void * data, std::uint64_t size)
+    {
+        auto bytes = static_cast<const std::uint8_t *>(data);
+        m_buffer.insert(m_buffer.end(), bytes, bytes + size);
+    }
+
+    void overwrite(std::uint64_t position, const void * data, std::uint64_t size)
+    {
+        std::memcpy(m_buffer.data() + position, data, static_cast<size_t>(size));
+    }
+
+    std::uint64_t position() const
+    {
+        return m_buffer.size();
+    }
+
+protected:
+    std::vector<std::uint8_t> & m_buffer;
+};
+
+
+/**
+*  @brief
+*    Output into a stream
+*/
+class StreamWriter
+{
+public:
+    explicit StreamWriter(std::ostream & stream)
+    : m_stream(stream)
+    , m_position(0)
+    {
+    }
+
+    void write(const void * data, std::uint64_t size)
+    {
+        m_stream.write(static_cast<const char *>(data), static_cast<std::streamsize>(size));
+        m_position += size;
+    }
+
+    void overwrite(std::uint64_t position, const void * data, std::uint64_t size)
+    {
+        m_stream.seekp(static_cast<std::streamoff>(position));
+        m_stream.write(static_cast<const char *>(data), static_cast<std::streamsize>(size));
+        m_stream.seekp(static_cast<std::streamoff>(m_position));
+    }
+
+    std::uint64_t position() const
+    {
+        return m_position;
+    }
+
+protected:
+    std::ostream & m_stream;
+    std::uint64_t  m_position;
+};
+
+
+/**
+*  @brief
+*    Document writer
+*/
+template <typename Writer>
+class DocumentWriter
+{
+public:
+    explicit DocumentWriter(Writer & writer)
+    : m_writer(writer)
+    {
+    }
+
+    void write(const Variant & root)
+    {
+        // Write header (the offset of the root value is not known yet)
+        const std::uint64_t rootOffset = 0;
+
+        m_writer.write(document::g_magic, sizeof(document::g_magic));
+        m_writer.write(&document::g_version, sizeof(document::g_version));
+        m_writer.write(&document::g_byteOrderMark, sizeof(document::g_byteOrderMark));
+        m_writer.write(&rootOffset, sizeof(rootOffset));
+
+        // Write values
+        const std::uint64_t offset = writeValue(root);
+        m_writer.overwrite(8, &offset, sizeof(offset));
+    }
+
+protected:
+    std::uint64_t writeValue(const Variant & value)
+    {
+        switch (value.variantType())
+        {
+            case VariantType::Bool:
+                return writeHeader(VariantType::Bool, value.value<bool>() ? 1 : 0);
+
+            case VariantType::Char:
+            case VariantType::Short:
+            case VariantType::Int:
+            case VariantType::Long:
+            case VariantType::LongLong:
+                return writeHeader(value.variantType(), static_cast<std::uint64_t>(value.value<long long>()));
+
+            case VariantType::UnsignedChar:
+            case VariantType::UnsignedShort:
+            case VariantType::UnsignedInt:
+            case VariantType::UnsignedLong:
+            case VariantType::UnsignedLongLong:
+                return writeHeader(value.variantType(), value.value<unsigned long long>());
+
+            case VariantType::Float:
+            case VariantType::Double:
+            {
+                const double number = value.value<double>();
+
+                std::uint64_t bits;
+                std::memcpy(&bits, &number, sizeof(bits));
+
+                return writeHeader(value.variantType(), bits);
+            }
+
+            case VariantType::String:
+                return writeString(*value.ptr<std::string>());
+
+            case VariantType::StringVector:
+            {
+                const auto & strings = *value.ptr<std::vector<std::string>>();
+
+                std::vector<std::uint64_t> offsets;
+                offsets.reserve(strings.size());
+
+                for (const auto & str : strings) {
+                    offsets.push_back(writeString(str));
+                }
+
+                return writeList(VariantType::StringVector, strings.size(), offsets);
+            }
+
+            case VariantType::VariantArray:
+            {
+                const auto & array = *value.asArray();
+
+                std::vector<std::uint64_t> offsets;
+                offsets.reserve(array.size());
+
+                for (const auto & element : array) {
+                    offsets.push_back(writeValue(element));
+                }
+
+                return writeList(VariantType::VariantArray, array.size(), offsets);
+            }
+
+            case VariantType::VariantMap:
+            {
+                // Variant maps are sorted by key, which enables the binary search in DocumentValue::find()
+                const auto & map = *value.asMap();
+
+                std::vector<std::uint64_t> offsets;
+                offsets.reserve(map.size() * 2);
+
+                for (const auto & it : map)
+                {
+                    offsets.push_back(writeString(it.first));
+                    offsets.push_back(writeValue(it.second));
+                }
+
+                return writeList(VariantType::VariantMap, map.size(), offsets);
+            }
+
+            case VariantType::FloatVector:
+                return writePackedArray(VariantType::FloatVector, *value.ptr<std::vector<float>>());
+
+            case VariantType::DoubleVector:
+                return writePackedArray(VariantType::DoubleVector, *value.ptr<std::vector<double>>());
+
+            case VariantType::Int32Vector:
+                return writePackedArray(VariantType::Int32Vector, *value.ptr<std::vector<std::int32_t>>());
+
+            case VariantType::Int64Vector:
+                return writePackedArray(VariantType::Int64Vector, *value.ptr<std::vector<std::int64_t>>());
+
+            case VariantType::UInt8Vector:
+                return writePackedArray(VariantType::UInt8Vector, *value.ptr<std::vector<std::uint8_t>>());
+
+            case VariantType::Other:
+                // Other primitive data types are stored as strings (like in JSON)
+                if (value.canConvert<std::string>()) {
+                    return writeString(value.toString());
+                }
+
+                return writeHeader(VariantType::Null, 0);
+
+            default:
+                return writeHeader(VariantType::Null, 0);
+        }
+    }
+
+    std::uint64_t writeHeader(VariantType type, std::uint64_t payload)
+    {
+        // Align value
+        const std::uint8_t padding[8] = {};
+
+        const auto remainder = m_writer.position() % document::g_alignment;
+        if (remainder != 0) {
+            m_writer.write(padding, document::g_alignment - remainder);
+        }
+
+        const std::uint64_t offset = m_writer.position();
+
+        const std::uint8_t header[8] = { static_cast<std::uint8_t>(type) };
+        m_writer.write(header, sizeof(header));
+        m_writer.write(&payload, sizeof(payload));
+
+        return offset;
+    }
+
+    std::uint64_t writeString(const std::string & str)
+    {
+        const std::uint64_t offset = writeHeader(VariantType::String, str.size());
+        m_writer.write(str.c_str(), str.size() + 1);
+
+        return offset;
+    }
+
+    std::uint64_t writeList(VariantType type, size_t count, const std::vector<std::uint64_t> & offsets)
+    {
+        const std::uint64_t offset = writeHeader(type, count);
+        m_writer.write(offsets.data(), offsets.size() * sizeof(std::uint64_t));
+
+        return offset;
+    }
+
+    template <typename T>
+    std::uint64_t writePackedArray(VariantType type, const std::vector<T> & values)
+    {
+        const std::uint64_t offset = writeHeader(type, values.size());
+        m_writer.write(values.data(), values.size() * sizeof(T));
+
+        return offset;
+    }
+
+protected:
+    Writer & m_writer;
+};
+
+
+void unmap(const std::uint8_t * data, size_t size)
+{
+#ifdef _WIN32
+    (void)size;
+    UnmapViewOfFile(data);
+#else
+    munmap(const_cast<std::uint8_t *>(data), size);
+#endif
+}
+
+
+} // namespace
+
+
+namespace cppexpose
+{
+
+
+std::vector<std::uint8_t> VariantDocument::encode(const Variant & root)
+{
+    std::vector<std::uint8_t> buffer;
+
+    BufferWriter writer(buffer);
+    DocumentWriter<BufferWriter>(writer).write(root);
+
+    return buffer;
+}
+
+bool VariantDocument::save(const Variant & root, const std::string & filename)
+{
+    std::ofstream stream(filename, std::ios::out | std::ios::binary);
+    if (!stream)
+    {
+        cppassist::critical() << "Could not open file '" << filename << "' for writing." << std::endl;
+        return false;
+    }
+
+    StreamWriter writer(stream);
+    DocumentWriter<StreamWriter>(writer).write(root);
+
+    return stream.good();
+}
+
+VariantDocument::VariantDocument()
+: m_data(nullptr)
+, m_size(0)
+, m_mapped(false)
+{
+}
+
+VariantDocument::~VariantDocument()
+{
+    close();
+}
+
+bool VariantDocument::load(const std::string & filename)
+{
+    close();
+
+    const std::uint8_t * data = nullptr;
+    size_t size = 0;
+
+#ifdef _WIN32
+    HANDLE file = CreateFileA(filename.c_str(), GENERIC_READ, FILE_SHARE_READ, nullptr, OPEN_EXISTING, FILE_ATTRIBUTE_NORMAL, nullptr);
+    if (file == INVALID_HANDLE_VALUE)
+    {
+        cppassist::critical() << "Could not open file '" << filename << "'." << std::endl;
+        return false;
+    }
+
+    LARGE_INTEGER fileSize;
+    if (GetFileSizeEx(file, &fileSize) && fileSize.QuadPart > 0 &&
+        static_cast<unsigned long long>(fileSize.QuadPart) <= std::numeric_limits<size_t>::max())
+    {
+        // The view keeps the mapping alive, so both handles can be closed immediately
+        HANDLE mapping = CreateFileMappingA(file, nullptr, PAGE_READONLY, 0, 0, nullptr);
+        if (mapping)
+        {
+            data = static_cast<const std::uint8_t *>(MapViewOfFile(mapping, FILE_MAP_READ, 0, 0, 0));
+            size = static_cast<size_t>(fileSize.QuadPart);
+            CloseHandle(mapping);
+        }
+    }
+
+    CloseHandle(file);
+#else
+    const int file = ::open(filename.c_str(), O_RDONLY);
+    if (file < 0)
+    {
+        cppassist::critical() << "Could not open file '" << filename << "'." << std::endl;
+        return false;
+    }
+
+    struct stat status;
+    if (fstat(file, &status) == 0 && status.st_size > 0 &&
+        static_cast<unsigned long long>(status.st_size) <= std::numeric_limits<size_t>::max())
+    {
+        // The mapping stays valid after closing the file
+        void * mapping = mmap(nullptr, static_cast<size_t>(status.st_size), PROT_READ, MAP_SHARED, file, 0);
+        if (mapping != MAP_FAILED)
+        {
+            data = static_cast<const std::uint8_t *>(mapping);
+            size = static_cast<size_t>(status.st_size);
+        }
+    }
+
+    ::close(file);
+#endif
+
+    if (!data)
+    {
+        cppassist::critical() << "Could not map file '" << filename << "' into memory." << std::endl;
+        return false;
+    }
+
+    if (!open(data, size))
+    {
+        unmap(data, size);
+        return false;
+    }
+
+    m_mapped = true;
+    return true;
+}
+
+bool VariantDocument::open(const void * data, size_t size)
+{
+    close();
+
+    auto bytes = static_cast<const std::uint8_t *>(data);
+
+    if (!bytes || reinterpret_cast<std::uintptr_t>(bytes) % document::g_alignment != 0)
+    {
+        cppassist::critical() << "Variant document data is not aligned." << std::endl;
+        return false;
+    }
+
+    // Check header
+    std::uint16_t version = 0;
+    std::uint16_t byteOrderMark = 0;
+
+    if (size >= document::g_headerSize)
+    {
+        std::memcpy(&version, bytes + 4, sizeof(version));
+        std::memcpy(&byteOrderMark, bytes + 6, sizeof(byteOrderMark));
+    }
+
+    if (size < document::g_headerSize || std::memcmp(bytes, document::g_magic, sizeof(document::g_magic)) != 0)
+    {
+        cppassist::critical() << "Data is not a variant document." << std::endl;
+        return false;
+    }
+
+    if (version != document::g_version || byteOrderMark != document::g_byteOrderMark)
+    {
+        cppassist::critical() << "Unsupported version or byte order of variant document." << std::endl;
+        return false;
+    }
+
+    // Check root value
+    const DocumentValue rootValue(bytes, size, document::readUInt64(bytes + 8));
+    if (!rootValue.m_data)
+    {
+        cppassist::critical() << "Invalid root value in variant document." << std::endl;
+        return false;
+    }
+
+    m_data = bytes;
+    m_size = size;
+
+    return true;
+}
+
+void VariantDocument::close()
+{
+    if (m_mapped) {
+        unmap(m_data, m_size);
+    }
+
+    m_data   = nullptr;
+    m_size   = 0;
+    m_mapped = false;
+}
+
+bool VariantDocument::isValid() const
+{
+    return m_data != nullptr;
+}
+
+size_t VariantDocument::size() const
+{
+    return m_size;
+}
+
+DocumentValue VariantDocument::root() const
+{
+    if (!m_data) {
+        return DocumentValue();
+    }
+
+    return DocumentValue(m_data, m_size, document::readUInt64(m_data + 8));
+}
+
+
+} // namespace cppexpose
@@ -0,0 +1,235 @@
+
+#include <cppexpose/variant/VariantPatch.h>
+
+#include <utility>
+
+
+namespace
+{
+
+
+const char * g_operationNames[] = { "add", "remove", "replace" };
+
+
+} // namespace
+
+
+namespace cppexpose
+{
+
+
+VariantPatch VariantPatch::diff(const Variant & from, const Variant & to)
+{
+    VariantPatch patch;
+    std::vector<std::string> path;
+    patch.compare(from, to, path);
+    return patch;
+}
+
+VariantPatch VariantPatch::fromVariant(const Variant & value)
+{
+    VariantPatch patch;
+
+    const VariantArray * changes = value.asArray();
+    if (!changes) {
+        return patch;
+    }
+
+    for (const Variant & change : *changes)
+    {
+        const VariantMap * map = change.asMap();
+        if (!map) {
+            return VariantPatch();
+        }
+
+        // Get operation
+        const auto opIt = map->find("op");
+        const std::string op = (opIt != map->end()) ? opIt->second.value<std::string>() : "";
+
+        size_t operation = 0;
+        while (operation < 3 && op != g_operationNames[operation]) {
+            ++operation;
+        }
+
+        if (operation == 3) {
+            return VariantPatch();
+        }
+
+        // Get path and value
+        const auto pathIt  = map->find("path");
+        const auto valueIt = map->find("value");
+
+        std::vector<std::string> path;
+        if (pathIt != map->end()) {
+            path = pathIt->second.toVector<std::string>();
+        }
+
+        patch.addChange(static_cast<Operation>(operation), path, valueIt != map->end() ? valueIt->second : Variant());
+    }
+
+    return patch;
+}
+
+bool VariantPatch::applyChange(Variant & target, const Change & change, size_t depth)
+{
+    const auto & path = change.path;
+
+    // Change of the root value
+    if (depth >= path.size())
+    {
+        target = (change.operation == Operation::Remove) ? Variant() : change.value;
+        return true;
+    }
+
+    // Find map that contains the value (only the maps on the path are detached)
+    Variant * current = &target;
+
+    for (size_t i = depth; i + 1 < path.size(); ++i)
+    {
+        VariantMap * map = current->asMap();
+        if (!map) {
+            return false;
+        }
+
+        auto it = map->find(path[i]);
+        if (it == map->end()) {
+            return false;
+        }
+
+        current = &it->second;
+    }
+
+    VariantMap * map = current->asMap();
+    if (!map) {
+        return false;
+    }
+
+    // Apply change
+    if (change.operation == Operation::Remove) {
+        return map->erase(path.back()) > 0;
+    }
+
+    (*map)[path.back()] = change.value;
+    return true;
+}
+
+VariantPatch::VariantPatch()
+{
+}
+
+bool VariantPatch::empty() const
+{
+    return m_changes.empty();
+}
+
+const std::vector<VariantPatch::Change> & VariantPatch::changes() const
+{
+    return m_changes;
+}
+
+void VariantPatch::addChange(Operation operation, const std::vector<std::string> & path, const Variant & value)
+{
+    Change change;
+    change.operation = operation;
+    change.path      = path;
+
+    if (operation != Operation::Remove) {
+        change.value = value;
+    }
+
+    m_changes.push_back(std::move(change));
+}
+
+bool VariantPatch::apply(Variant & target) const
+{
+    bool success = true;
+
+    for (const auto & change : m_changes)
+    {
+        success = applyChange(target, change) && success;
+    }
+
+    return success;
+}
+
+Variant VariantPatch::toVariant() const
+{
+    Variant changes = Variant::array();
+    changes.asArray()->reserve(m_changes.size());
+
+    for (const auto & change : m_changes)
+    {
+        Variant path = Variant::array();
+        for (const auto & key : change.path) {
+            path.asArray()->emplace_back(key);
+        }
+
+        Variant map = Variant::map();
+        (*map.asMap())["op"]   = g_operationNames[static_cast<size_t>(change.operation)];
+        (*map.asMap())["path"] = std::move(path);
+
+        if (change.operation != Operation::Remove) {
+            (*map.asMap())["value"] = change.value;
+        }
+
+        changes.asArray()->push_back(std::move(map));
+    }
+
+    return changes;
+}
+
+void VariantPatch::compare(const Variant & from, const Variant & to, std::vector<std::string> & path)
+{
+    // Unchanged values (compares shared data and cached hashes first)
+    if (from == to) {
+        return;
+    }
+
+    // Values other than maps are replaced as a whole
+    const VariantMap * fromMap = from.asMap();
+    const VariantMap * toMap   = to.asMap();
+
+    if (!fromMap || !toMap)
+    {
+        addChange(Operation::Replace, path, to);
+        return;
+    }
+
+    // Both maps are sorted by key, so they can be compared in a single pass
+    auto fromIt = fromMap->begin();
+    auto toIt   = toMap->begin();
+
+    while (fromIt != fromMap->end() || toIt != toMap->end())
+    {
+        if (toIt == toMap->end() || (fromIt != fromMap->end() && fromIt->first < toIt->first))
+        {
+            path.push_back(fromIt->first);
+            addChange(Operation::Remove, path);
+            path.pop_back();
+
+            ++fromIt;
+        }
+
+        else if (fromIt == fromMap->end() || toIt->first < fromIt->first)
+        {
+            path.push_back(toIt->first);
+            addChange(Operation::Add, path, toIt->second);
+            path.pop_back();
+
+            ++toIt;
+        }
+
+        else
+        {
+            path.push_back(toIt->first);
+            compare(fromIt->second, toIt->second, path);
+            path.pop_back();
+
+            ++fromIt;
+            ++toIt;
+        }
+    }
+}
+
+
+} // namespace cppexpose
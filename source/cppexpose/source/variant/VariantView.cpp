@@ -0,0 +1,326 @@
+
+#include <cppexpose/variant/VariantView.h>
+
+#include <functional>
+
+#include <cppexpose/base/template_helpers.h>
+
+
+namespace
+{
+
+
+// Visitors for raw scalars (see VariantView::visitScalar())
+
+struct TypeVisitor
+{
+    template <typename T>
+    std::reference_wrapper<const std::type_info> operator()(const T &) const
+    {
+        return std::cref(typeid(T));
+    }
+};
+
+struct ToVariantVisitor
+{
+    template <typename T>
+    cppexpose::Variant operator()(const T & value) const
+    {
+        return cppexpose::Variant(value);
+    }
+};
+
+struct IsNumberVisitor
+{
+    template <typename T>
+    bool operator()(const T &) const
+    {
+        return cppexpose::helper::isIntegral<T>::value || cppexpose::helper::isFloatingPoint<T>::value;
+    }
+};
+
+struct IsIntegralVisitor
+{
+    template <typename T>
+    bool operator()(const T &) const
+    {
+        return cppexpose::helper::isIntegral<T>::value;
+    }
+};
+
+struct IsSignedIntegralVisitor
+{
+    template <typename T>
+    bool operator()(const T &) const
+    {
+        return cppexpose::helper::isSignedIntegral<T>::value;
+    }
+};
+
+struct IsUnsignedIntegralVisitor
+{
+    template <typename T>
+    bool operator()(const T &) const
+    {
+        return cppexpose::helper::isUnsignedIntegral<T>::value;
+    }
+};
+
+
+} // namespace
+
+
+namespace cppexpose
+{
+
+
+VariantView::VariantView()
+: m_variant(nullptr)
+, m_typed(nullptr)
+, m_data(nullptr)
+, m_type(VariantType::Null)
+{
+}
+
+VariantView::VariantView(const Variant & variant)
+: m_variant(&variant)
+, m_typed(nullptr)
+, m_data(nullptr)
+, m_type(VariantType::Null)
+{
+}
+
+VariantView::VariantView(const AbstractTyped & value)
+: m_variant(nullptr)
+, m_typed(&value)
+, m_data(nullptr)
+, m_type(VariantType::Other)
+{
+}
+
+bool VariantView::isNull() const
+{
+    if (m_variant) return m_variant->isNull();
+    else           return !m_typed && !m_data;
+}
+
+bool VariantView::isVariantArray() const
+{
+    return variantType() == VariantType::VariantArray;
+}
+
+bool VariantView::isVariantMap() const
+{
+    return variantType() == VariantType::VariantMap;
+}
+
+bool VariantView::isPackedArray() const
+{
+    const VariantType type = variantType();
+    return type >= VariantType::FloatVector && type <= VariantType::UInt8Vector;
+}
+
+const std::type_info & VariantView::type() const
+{
+    if (m_variant) {
+        return m_variant->type();
+    }
+
+    if (m_typed) {
+        return m_typed->type();
+    }
+
+    return visitScalar<std::reference_wrapper<const std::type_info>>(TypeVisitor(), std::cref(typeid(void)));
+}
+
+VariantType VariantView::variantType() const
+{
+    if (m_variant) return m_variant->variantType();
+    else           return m_type;
+}
+
+const VariantArray * VariantView::asArray() const
+{
+    return ptr<VariantArray>();
+}
+
+const VariantMap * VariantView::asMap() const
+{
+    return ptr<VariantMap>();
+}
+
+const Variant * VariantView::variant() const
+{
+    return m_variant;
+}
+
+const AbstractTyped * VariantView::typed() const
+{
+    return m_typed;
+}
+
+bool VariantView::isComposite() const
+{
+    if (m_typed) return m_typed->isComposite();
+    else         return false;
+}
+
+size_t VariantView::numSubValues() const
+{
+    if (m_typed) return m_typed->numSubValues();
+    else         return 0;
+}
+
+VariantView VariantView::subValue(size_t index) const
+{
+    if (!m_typed) {
+        return VariantView();
+    }
+
+    // subValue() does not modify the typed value, but has no const overload
+    const AbstractTyped * value = const_cast<AbstractTyped *>(m_typed)->subValue(index);
+
+    if (value) return VariantView(*value);
+    else       return VariantView();
+}
+
+Variant VariantView::toVariant() const
+{
+    if (m_variant) {
+        return *m_variant;
+    }
+
+    if (m_typed) {
+        return m_typed->toVariant();
+    }
+
+    return visitScalar<Variant>(ToVariantVisitor(), Variant());
+}
+
+std::string VariantView::toJSON(JSON::OutputMode outputMode) const
+{
+    if (m_variant) return m_variant->toJSON(outputMode);
+    else           return toVariant().toJSON(outputMode);
+}
+
+bool VariantView::isEnum() const
+{
+    if (m_variant)    return m_variant->isEnum();
+    else if (m_typed) return m_typed->isEnum();
+    else              return false;
+}
+
+bool VariantView::isArray() const
+{
+    if (m_variant)    return m_variant->isArray();
+    else if (m_typed) return m_typed->isArray();
+    else              return false;
+}
+
+bool VariantView::isVariant() const
+{
+    if (m_variant)    return m_variant->isVariant();
+    else if (m_typed) return m_typed->isVariant();
+    else              return false;
+}
+
+bool VariantView::isString() const
+{
+    if (m_variant)    return m_variant->isString();
+    else if (m_typed) return m_typed->isString();
+    else              return m_type == VariantType::String;
+}
+
+bool VariantView::isBool() const
+{
+    if (m_variant)    return m_variant->isBool();
+    else if (m_typed) return m_typed->isBool();
+    else              return m_type == VariantType::Bool;
+}
+
+bool VariantView::isNumber() const
+{
+    if (m_variant)    return m_variant->isNumber();
+    else if (m_typed) return m_typed->isNumber();
+
+    return visitScalar<bool>(IsNumberVisitor(), false);
+}
+
+bool VariantView::isIntegral() const
+{
+    if (m_variant)    return m_variant->isIntegral();
+    else if (m_typed) return m_typed->isIntegral();
+
+    return visitScalar<bool>(IsIntegralVisitor(), false);
+}
+
+bool VariantView::isSignedIntegral() const
+{
+    if (m_variant)    return m_variant->isSignedIntegral();
+    else if (m_typed) return m_typed->isSignedIntegral();
+
+    return visitScalar<bool>(IsSignedIntegralVisitor(), false);
+}
+
+bool VariantView::isUnsignedIntegral() const
+{
+    if (m_variant)    return m_variant->isUnsignedIntegral();
+    else if (m_typed) return m_typed->isUnsignedIntegral();
+
+    return visitScalar<bool>(IsUnsignedIntegralVisitor(), false);
+}
+
+bool VariantView::isFloatingPoint() const
+{
+    if (m_variant)    return m_variant->isFloatingPoint();
+    else if (m_typed) return m_typed->isFloatingPoint();
+    else              return m_type == VariantType::Float || m_type == VariantType::Double;
+}
+
+std::string VariantView::toString() const
+{
+    if (m_variant)    return m_variant->toString();
+    else if (m_typed) return m_typed->toString();
+
+    // Avoid copying referenced strings
+    if (m_type == VariantType::String) {
+        return *static_cast<const std::string *>(m_data);
+    }
+
+    return convertScalar<std::string>();
+}
+
+bool VariantView::toBool() const
+{
+    if (m_variant)    return m_variant->toBool();
+    else if (m_typed) return m_typed->toBool();
+
+    return convertScalar<bool>();
+}
+
+long long VariantView::toLongLong() const
+{
+    if (m_variant)    return m_variant->toLongLong();
+    else if (m_typed) return m_typed->toLongLong();
+
+    return convertScalar<long long>();
+}
+
+unsigned long long VariantView::toULongLong() const
+{
+    if (m_variant)    return m_variant->toULongLong();
+    else if (m_typed) return m_typed->toULongLong();
+
+    return convertScalar<unsigned long long>();
+}
+
+double VariantView::toDouble() const
+{
+    if (m_variant)    return m_variant->toDouble();
+    else if (m_typed) return m_typed->toDouble();
+
+    return convertScalar<double>();
+}
+
+
+} // namespace cppexpose
@@ -0,0 +1,96 @@
+#include <chrono>
+#include <string>
+#include <vector>
+#include <iostream>
+
+#include <cppassist/string/conversion.h>
+
+#include <cppexpose/typed/DirectValue.h>
+
+
+using namespace cppassist;
+using namespace cppexpose;
+
+
+namespace
+{
+
+
+const int g_iterations = 1000000;
+
+
+template <typename Function>
+double measure(Function function)
+{
+    const auto start = std::chrono::steady_clock::now();
+
+    function();
+
+    const auto end = std::chrono::steady_clock::now();
+
+    return std::chrono::duration<double, std::milli>(end - start).count();
+}
+
+template <typename T>
+void compare(const std::string & name, const std::vector<T> & values)
+{
+    std::vector<std::string> strings(values.size());
+    double check = 0.0;
+
+    // Format numbers with string streams (cppassist) and with the number helpers (typed values)
+    const double streamFormat = measure([&] ()
+    {
+        for (int i = 0; i < g_iterations; i++) {
+            strings[i % values.size()] = string::toString<T>(values[i % values.size()]);
+        }
+    });
+
+    const double typedFormat = measure([&] ()
+    {
+        DirectValue<T> value;
+
+        for (int i = 0; i < g_iterations; i++) {
+            value.setValue(values[i % values.size()]);
+            strings[i % values.size()] = value.toString();
+        }
+    });
+
+    // Parse the formatted numbers again
+    const double streamParse = measure([&] ()
+    {
+        for (int i = 0; i < g_iterations; i++) {
+            check += static_cast<double>(string::fromString<T>(strings[i % strings.size()]));
+        }
+    });
+
+    const double typedParse = measure([&] ()
+    {
+        DirectValue<T> value;
+
+        for (int i = 0; i < g_iterations; i++) {
+            value.fromString(strings[i % strings.size()]);
+            check += static_cast<double>(value.value());
+        }
+    });
+
+    std::cout << name << std::endl;
+    std::cout << "  toString:   cppassist " << streamFormat << " ms, typed " << typedFormat << " ms" << std::endl;
+    std::cout << "  fromString: cppassist " << streamParse  << " ms, typed " << typedParse  << " ms" << std::endl;
+    std::cout << "  (checksum " << check << ")" << std::endl;
+}
+
+
+} // namespace
+
+
+int main(int, char * [])
+{
+    std::cout << "Converting " << g_iterations << " numbers from and to strings" << std::endl << std::endl;
+
+    compare<int>("int", { 0, 7, -42, 1234567, -2147483647 });
+    compare<unsigned long long>("unsigned long long", { 0u, 42u, 18446744073709551615ull });
+    compare<float>("float", { 0.0f, 0.1f, -2.5f, 3.14159f, 1e20f });
+    compare<double>("double", { 0.0, 0.1, -2.5, 1.0 / 3.0, 1e-300 });
+
+    return 0;
+}
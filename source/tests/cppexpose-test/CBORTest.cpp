@@ -0,0 +1,160 @@
+
+#include <cstdint>
+#include <limits>
+#include <sstream>
+#include <string>
+#include <vector>
+
+#include <gmock/gmock.h>
+
+#include <cppexpose/cbor/CBOR.h>
+#include <cppexpose/json/JSON.h>
+#include <cppexpose/variant/Variant.h>
+
+
+using namespace cppexpose;
+
+
+class CBORTest : public testing::Test
+{
+public:
+    CBORTest()
+    {
+    }
+
+    static Variant roundTrip(const Variant & value)
+    {
+        Variant result;
+        EXPECT_TRUE(CBOR::decode(result, CBOR::encode(value)));
+        return result;
+    }
+};
+
+
+TEST_F(CBORTest, encodeScalars)
+{
+    const std::vector<std::uint8_t> map = { 0xa1, 0x61, 'a', 0x01 };
+    VariantMap values;
+    values["a"] = 1;
+    ASSERT_EQ(map, CBOR::encode(Variant(values)));
+
+    ASSERT_EQ(std::vector<std::uint8_t>({ 0x17 }),             CBOR::encode(Variant(23)));
+    ASSERT_EQ(std::vector<std::uint8_t>({ 0x18, 0x18 }),       CBOR::encode(Variant(24)));
+    ASSERT_EQ(std::vector<std::uint8_t>({ 0x19, 0x03, 0xe8 }), CBOR::encode(Variant(1000u)));
+    ASSERT_EQ(std::vector<std::uint8_t>({ 0x38, 0x63 }),       CBOR::encode(Variant(-100)));
+    ASSERT_EQ(std::vector<std::uint8_t>({ 0xf5 }),             CBOR::encode(Variant(true)));
+    ASSERT_EQ(std::vector<std::uint8_t>({ 0xf6 }),             CBOR::encode(Variant()));
+    ASSERT_EQ(std::vector<std::uint8_t>({ 0xfb, 0x3f, 0xf1, 0x99, 0x99, 0x99, 0x99, 0x99, 0x9a }), CBOR::encode(Variant(1.1)));
+}
+
+TEST_F(CBORTest, roundTripScalars)
+{
+    ASSERT_TRUE(roundTrip(Variant()).isNull());
+    ASSERT_EQ(false, roundTrip(Variant(false)).value<bool>());
+    ASSERT_EQ(-7, roundTrip(Variant(-7)).value<int>());
+    ASSERT_EQ(1.5f, roundTrip(Variant(1.5f)).value<float>());
+    ASSERT_EQ(0.1, roundTrip(Variant(0.1)).value<double>());
+    ASSERT_EQ("text", roundTrip(Variant(std::string("text"))).value<std::string>());
+
+    const long long minimum = std::numeric_limits<long long>::min();
+    ASSERT_EQ(minimum, roundTrip(Variant(minimum)).value<long long>());
+
+    const unsigned long long maximum = std::numeric_limits<unsigned long long>::max();
+    ASSERT_EQ(maximum, roundTrip(Variant(maximum)).value<unsigned long long>());
+}
+
+TEST_F(CBORTest, roundTripTree)
+{
+    Variant value;
+    JSON::parse(value, "{\"name\": \"test\", \"list\": [1, -2, 3.5, null, true], \"nested\": {\"a\": {}, \"b\": []}}");
+
+    const Variant result = roundTrip(value);
+    ASSERT_EQ(JSON::stringify(value), JSON::stringify(result));
+}
+
+TEST_F(CBORTest, roundTripPackedArrays)
+{
+    const std::vector<float>        floats  = { 1.0f, -2.5f, 3.25f };
+    const std::vector<double>       doubles = { 0.1, 1e300, -0.0 };
+    const std::vector<std::int32_t> ints    = { -1, 0, 2147483647 };
+    const std::vector<std::int64_t> longs   = { -1, 0, 1ll << 40 };
+    const std::vector<std::uint8_t> bytes   = { 0, 128, 255 };
+
+    ASSERT_EQ(floats,  *roundTrip(Variant(floats)).ptr<std::vector<float>>());
+    ASSERT_EQ(doubles, *roundTrip(Variant(doubles)).ptr<std::vector<double>>());
+    ASSERT_EQ(ints,    *roundTrip(Variant(ints)).ptr<std::vector<std::int32_t>>());
+    ASSERT_EQ(longs,   *roundTrip(Variant(longs)).ptr<std::vector<std::int64_t>>());
+    ASSERT_EQ(bytes,   *roundTrip(Variant(bytes)).ptr<std::vector<std::uint8_t>>());
+}
+
+TEST_F(CBORTest, decodeForeignData)
+{
+    Variant value;
+
+    // Indefinite length array and string: [_ 1, (_ "ab", "c")]
+    const std::vector<std::uint8_t> indefinite = { 0x9f, 0x01, 0x7f, 0x62, 'a', 'b', 0x61, 'c', 0xff, 0xff };
+    ASSERT_TRUE(CBOR::decode(value, indefinite));
+    ASSERT_EQ(2u, value.asArray()->size());
+    ASSERT_EQ("abc", value.asArray()->at(1).value<std::string>());
+
+    // Half float (1.5) and typed array in big endian (float32 [1.0])
+    ASSERT_TRUE(CBOR::decode(value, std::vector<std::uint8_t>({ 0xf9, 0x3e, 0x00 })));
+    ASSERT_EQ(1.5f, value.value<float>());
+
+    ASSERT_TRUE(CBOR::decode(value, std::vector<std::uint8_t>({ 0xd8, 0x51, 0x44, 0x3f, 0x80, 0x00, 0x00 })));
+    ASSERT_EQ(std::vector<float>({ 1.0f }), *value.ptr<std::vector<float>>());
+
+    // Integer map key
+    ASSERT_TRUE(CBOR::decode(value, std::vector<std::uint8_t>({ 0xa1, 0x05, 0x61, 'x' })));
+    ASSERT_EQ("x", value.asMap()->at("5").value<std::string>());
+}
+
+TEST_F(CBORTest, decodeInvalidData)
+{
+    Variant value;
+
+    // Truncated data
+    ASSERT_FALSE(CBOR::decode(value, std::vector<std::uint8_t>()));
+    ASSERT_FALSE(CBOR::decode(value, std::vector<std::uint8_t>({ 0x19, 0x03 })));
+    ASSERT_FALSE(CBOR::decode(value, std::vector<std::uint8_t>({ 0x63, 'a', 'b' })));
+    ASSERT_FALSE(CBOR::decode(value, std::vector<std::uint8_t>({ 0x82, 0x01 })));
+
+    // Huge length that exceeds the data
+    ASSERT_FALSE(CBOR::decode(value, std::vector<std::uint8_t>({ 0x9b, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff })));
+
+    // Nested arrays whose lengths fit into the remaining data, but not all of them at once
+    std::vector<std::uint8_t> nested;
+    for (int i = 0; i < 256; ++i)
+    {
+        nested.insert(nested.end(), { 0x99, 0x10, 0x00 });
+    }
+    nested.resize(nested.size() + 0x2000, 0x00);
+    ASSERT_FALSE(CBOR::decode(value, nested));
+
+    // Reserved additional information, unexpected break and invalid typed array size
+    ASSERT_FALSE(CBOR::decode(value, std::vector<std::uint8_t>({ 0x1c })));
+    ASSERT_FALSE(CBOR::decode(value, std::vector<std::uint8_t>({ 0xff })));
+    ASSERT_FALSE(CBOR::decode(value, std::vector<std::uint8_t>({ 0xd8, 0x55, 0x43, 0x00, 0x00, 0x00 })));
+}
+
+TEST_F(CBORTest, stream)
+{
+    VariantArray array;
+    array.push_back(1);
+    array.push_back(std::string("two"));
+
+    std::stringstream stream;
+    ASSERT_TRUE(CBOR::encode(Variant(array), stream));
+    ASSERT_TRUE(CBOR::encode(Variant(3.0), stream));
+
+    Variant first;
+    Variant second;
+    ASSERT_TRUE(CBOR::decode(first, stream));
+    ASSERT_TRUE(CBOR::decode(second, stream));
+
+    ASSERT_EQ(Variant(array), first);
+    ASSERT_EQ(3.0, second.value<double>());
+
+    Variant third;
+    ASSERT_FALSE(CBOR::decode(third, stream));
+}
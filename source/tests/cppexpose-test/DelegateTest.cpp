@@ -0,0 +1,110 @@
+
+#include <array>
+#include <functional>
+#include <memory>
+
+#include <gmock/gmock.h>
+
+#include <cppexpose/base/Delegate.h>
+#include <cppexpose/typed/StoredValue.h>
+
+
+using namespace cppexpose;
+
+
+class DelegateTest : public testing::Test
+{
+public:
+    DelegateTest()
+    {
+    }
+};
+
+
+namespace
+{
+    int triple(int value)
+    {
+        return value * 3;
+    }
+
+    class Counter
+    {
+    public:
+        Counter() : m_count(0) {}
+
+        int count() const { return m_count; }
+        void setCount(const int & count) { m_count = count; }
+
+    protected:
+        int m_count;
+    };
+}
+
+
+TEST_F(DelegateTest, call)
+{
+    Delegate<int (int)> empty;
+    ASSERT_FALSE(empty);
+
+    Delegate<int (int)> function(&triple);
+    ASSERT_TRUE(function);
+    ASSERT_EQ(6, function(2));
+
+    int offset = 1;
+    Delegate<int (int)> lambda([offset] (int value) { return value + offset; });
+    ASSERT_EQ(3, lambda(2));
+
+    std::function<int (int)> stdFunction = [] (int value) { return -value; };
+    Delegate<int (int)> wrapped(stdFunction);
+    ASSERT_EQ(-2, wrapped(2));
+
+    // Return value is ignored for void delegates
+    Delegate<void (int)> ignore(&triple);
+    ignore(1);
+}
+
+TEST_F(DelegateTest, copyAndMove)
+{
+    // Callables that are too large for the inline storage are stored on the heap
+    std::array<int, 16> values;
+    values.fill(2);
+    auto shared = std::make_shared<int>(5);
+
+    Delegate<int ()> large([values] () { return values[15]; });
+    Delegate<int ()> small([shared] () { return *shared; });
+    ASSERT_EQ(2, shared.use_count());
+
+    Delegate<int ()> largeCopy(large);
+    Delegate<int ()> smallCopy(small);
+    ASSERT_EQ(3, shared.use_count());
+    ASSERT_EQ(2, largeCopy());
+    ASSERT_EQ(5, smallCopy());
+
+    Delegate<int ()> moved(std::move(smallCopy));
+    ASSERT_FALSE(smallCopy);
+    ASSERT_EQ(5, moved());
+    ASSERT_EQ(3, shared.use_count());
+
+    moved = large;
+    ASSERT_EQ(2, moved());
+    ASSERT_EQ(2, shared.use_count());
+
+    small = nullptr;
+    ASSERT_EQ(1, shared.use_count());
+}
+
+TEST_F(DelegateTest, storedValue)
+{
+    Counter counter;
+
+    StoredValue<int> value(&counter, &Counter::count, &Counter::setCount);
+    value.setValue(4);
+    ASSERT_EQ(4, counter.count());
+
+    std::unique_ptr<AbstractTyped> clone = value.clone();
+    counter.setCount(7);
+
+    auto typed = static_cast<Typed<int, AbstractTyped> *>(clone.get());
+    ASSERT_EQ(7, typed->value());
+}
@@ -1,9 +1,11 @@
 
 #include <array>
+#include <limits>
 
 #include <gmock/gmock.h>
 
 #include <cppexpose/typed/DirectValue.h>
+#include <cppexpose/variant/Variant.h>
 
 
 using namespace cppexpose;
@@ -61,6 +63,114 @@ TEST_F(DirectValueTest, arraySet)
     ASSERT_EQ(10, val.getElement(0));
 }
 
+TEST_F(DirectValueTest, arrayBulkAccess)
+{
+    auto val = DirectValue<std::array<int, 4>>(std::array<int, 4>{ {1, 2, 3, 4} });
+
+    const int elements[] = { 10, 20, 30 };
+    ASSERT_EQ(2u, val.setElements(2, 3, elements));
+
+    int result[4] = {};
+    ASSERT_EQ(4u, val.getElements(0, 4, result));
+    ASSERT_EQ(1, result[0]);
+    ASSERT_EQ(2, result[1]);
+    ASSERT_EQ(10, result[2]);
+    ASSERT_EQ(20, result[3]);
+
+    ASSERT_EQ(0u, val.getElements(4, 1, result));
+
+    ASSERT_TRUE(val.fromString("(5, 6, 7, 8)"));
+    ASSERT_EQ("(5, 6, 7, 8)", val.toString());
+
+    // Invalid strings do not change the array
+    ASSERT_FALSE(val.fromString("(1, 2)"));
+    ASSERT_EQ(5, val.getElement(0));
+}
+
+TEST_F(DirectValueTest, numberStrings)
+{
+    // Floating point values are formatted with the fewest digits that round-trip
+    ASSERT_EQ("0.1", DirectValue<float>(0.1f).toString());
+    ASSERT_EQ("0.1", DirectValue<double>(0.1).toString());
+    ASSERT_EQ("16777216", DirectValue<float>(16777216.0f).toString());
+    ASSERT_EQ("1e-300", DirectValue<double>(1e-300).toString());
+
+    const double third = 1.0 / 3.0;
+    DirectValue<double> parsed;
+    ASSERT_TRUE(parsed.fromString(DirectValue<double>(third).toString()));
+    ASSERT_EQ(third, parsed.value());
+
+    // Variants format their numbers like the typed values
+    ASSERT_EQ(DirectValue<double>(third).toString(), Variant(third).toString());
+    ASSERT_EQ(DirectValue<float>(0.1f).toString(), Variant(0.1f).toString());
+    ASSERT_EQ(DirectValue<double>(1e-300).toString(), Variant(1e-300).toString());
+    ASSERT_EQ(third, Variant(Variant(third).toString()).value<double>());
+
+    ASSERT_TRUE(parsed.fromString("  -2.5e3"));
+    ASSERT_EQ(-2500.0, parsed.value());
+
+    // Integral values are clamped to the range of the type
+    DirectValue<short> int16;
+    ASSERT_TRUE(int16.fromString("40000"));
+    ASSERT_EQ(32767, int16.value());
+    ASSERT_EQ("32767", int16.toString());
+
+    DirectValue<unsigned short> uint16;
+    ASSERT_TRUE(uint16.fromString("70000"));
+    ASSERT_EQ(65535, uint16.value());
+
+    // 8-bit integers are characters, in typed values and variants alike
+    ASSERT_EQ("a", DirectValue<char>('a').toString());
+    ASSERT_EQ(Variant('a').toString(), DirectValue<char>('a').toString());
+    ASSERT_EQ("A", DirectValue<unsigned char>(65).toString());
+    ASSERT_EQ(Variant(static_cast<unsigned char>(65)).toString(), DirectValue<unsigned char>(65).toString());
+    ASSERT_EQ("A", DirectValue<signed char>(65).toString());
+
+    DirectValue<char> character;
+    ASSERT_TRUE(character.fromString(" b"));
+    ASSERT_EQ('b', character.value());
+    ASSERT_EQ('b', Variant(" b").value<char>());
+
+    ASSERT_EQ("-9223372036854775808", DirectValue<long long>(std::numeric_limits<long long>::min()).toString());
+    ASSERT_EQ("18446744073709551615", DirectValue<unsigned long long>(std::numeric_limits<unsigned long long>::max()).toString());
+
+    ASSERT_EQ(0.25, DirectValue<string>("0.25").toDouble());
+    ASSERT_EQ(-7, DirectValue<string>("-7").toLongLong());
+}
+
+TEST_F(DirectValueTest, arraySubValues)
+{
+    using Vec3 = std::array<float, 3>;
+
+    auto val = DirectValue<Vec3>(Vec3{ { 1.0f, 2.0f, 3.0f } });
+
+    ASSERT_EQ(3u, val.numSubValues());
+    auto element = static_cast<Typed<float, AbstractTyped> *>(val.subValue(2));
+    ASSERT_EQ(3.0f, element->value());
+    ASSERT_FALSE(element->isReadOnly());
+
+    // Elements of direct arrays are read in place
+    const auto * constElement = element;
+    ASSERT_EQ(&val.ptr()->at(2), constElement->ptr());
+
+    element->setValue(30.0f);
+    ASSERT_EQ(30.0f, val.getElement(2));
+
+    // Accessors can also be created on the stack, and clones refer to the same element
+    ArrayElement<float, TypedArray<Vec3, float, 3, AbstractTyped>> first(&val, 0);
+    ASSERT_EQ("1", first.toString());
+
+    std::unique_ptr<AbstractTyped> clone = first.clone();
+    ASSERT_TRUE(clone->fromString("5"));
+    ASSERT_EQ(5.0f, val.getElement(0));
+
+    // Copies do not share the accessors of the original
+    auto copy = val;
+    copy.subValue(0)->fromString("7");
+    ASSERT_EQ(7.0f, copy.getElement(0));
+    ASSERT_EQ(5.0f, val.getElement(0));
+}
+
 TEST_F(DirectValueTest, constSet)
 {
     auto val = DirectValue<const bool>(false);
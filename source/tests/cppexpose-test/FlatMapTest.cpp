@@ -0,0 +1,104 @@
+
+#include <string>
+#include <iterator>
+#include <type_traits>
+
+#include <gmock/gmock.h>
+
+#include <cppexpose/base/FlatMap.h>
+
+
+using namespace cppexpose;
+
+
+class FlatMapTest : public testing::Test
+{
+public:
+    FlatMapTest()
+    {
+    }
+};
+
+
+TEST_F(FlatMapTest, insertSorted)
+{
+    FlatMap<std::string, int> map;
+
+    map["c"] = 3;
+    map["a"] = 1;
+    ASSERT_TRUE(map.insert({"b", 2}).second);
+    ASSERT_FALSE(map.insert({"b", 4}).second);
+    ASSERT_TRUE(map.emplace("d", 4).second);
+
+    ASSERT_EQ(4u, map.size());
+    ASSERT_EQ(2, map.at("b"));
+
+    std::string keys;
+    for (const auto & entry : map)
+    {
+        keys += entry.first;
+    }
+
+    ASSERT_EQ("abcd", keys);
+}
+
+TEST_F(FlatMapTest, findAndErase)
+{
+    FlatMap<std::string, int> map = { {"x", 1}, {"y", 2}, {"z", 3} };
+
+    ASSERT_EQ(1u, map.count("y"));
+    ASSERT_EQ(0u, map.count("w"));
+    ASSERT_TRUE(map.find("w") == map.end());
+    ASSERT_EQ(3, map.find("z")->second);
+
+    ASSERT_EQ(1u, map.erase("y"));
+    ASSERT_EQ(0u, map.erase("y"));
+    ASSERT_TRUE(map.find("y") == map.end());
+
+    map.erase(map.find("x"));
+    ASSERT_EQ(1u, map.size());
+    ASSERT_EQ("z", map.begin()->first);
+}
+
+TEST_F(FlatMapTest, constKeys)
+{
+    using Map = FlatMap<std::string, int>;
+    using Entry = std::pair<const std::string, int>;
+
+    // Keys cannot be changed through iterators, as in std::map
+    static_assert(std::is_same<std::iterator_traits<Map::iterator>::reference, Entry &>::value, "Entries must have const keys");
+    static_assert(std::is_same<std::iterator_traits<Map::const_iterator>::reference, const Entry &>::value, "Entries must have const keys");
+
+    Map map = { {"b", 2}, {"a", 1} };
+
+    for (auto & entry : map)
+    {
+        entry.second *= 10;
+    }
+
+    Map::const_iterator it = map.find("b");
+    ASSERT_TRUE(it == map.find("b"));
+    ASSERT_EQ(20, it->second);
+    ASSERT_EQ("a", (--it)->first);
+    ASSERT_TRUE(it == map.cbegin());
+}
+
+TEST_F(FlatMapTest, copyAndShift)
+{
+    FlatMap<std::string, std::string> map = { {"b", "2"}, {"d", "4"} };
+    FlatMap<std::string, std::string> copy;
+    copy["x"] = "0";
+
+    // Entries with const keys are copied and shifted without assignment
+    copy = map;
+    copy["c"] = "3";
+    copy["a"] = "1";
+    copy.erase("b");
+    copy.erase(copy.find("a"));
+
+    ASSERT_EQ(2u, copy.size());
+    ASSERT_EQ("3", copy.begin()->second);
+    ASSERT_EQ("4", copy.at("d"));
+    ASSERT_EQ(2u, map.size());
+    ASSERT_TRUE(map != copy);
+}
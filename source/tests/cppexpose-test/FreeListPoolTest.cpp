@@ -0,0 +1,85 @@
+
+#include <gmock/gmock.h>
+
+#include <cppassist/memory/make_unique.h>
+
+#include <cppexpose/base/FreeListPool.h>
+#include <cppexpose/function/Function.h>
+#include <cppexpose/function/StaticFunction.h>
+#include <cppexpose/typed/DirectValue.h>
+#include <cppexpose/typed/StoredValue.h>
+
+
+using namespace cppexpose;
+
+
+class FreeListPoolTest : public testing::Test
+{
+public:
+    FreeListPoolTest()
+    {
+        FreeListPool::release();
+    }
+};
+
+
+namespace
+{
+    int staticFunction(int value)
+    {
+        return value * 2;
+    }
+}
+
+
+TEST_F(FreeListPoolTest, recycleBlocks)
+{
+    void * first = FreeListPool::allocate(40);
+    FreeListPool::deallocate(first, 40);
+    ASSERT_EQ(1u, FreeListPool::numCachedBlocks());
+
+    // Blocks are reused for all sizes of a size class
+    void * second = FreeListPool::allocate(48);
+    ASSERT_EQ(first, second);
+    ASSERT_EQ(0u, FreeListPool::numCachedBlocks());
+    FreeListPool::deallocate(second, 48);
+
+    // Large blocks are not cached
+    void * large = FreeListPool::allocate(FreeListPool::maxBlockSize + 1);
+    FreeListPool::deallocate(large, FreeListPool::maxBlockSize + 1);
+    ASSERT_EQ(1u, FreeListPool::numCachedBlocks());
+
+    FreeListPool::release();
+    ASSERT_EQ(0u, FreeListPool::numCachedBlocks());
+}
+
+TEST_F(FreeListPoolTest, recycleClones)
+{
+    DirectValue<int> value(42);
+
+    const AbstractTyped * previous = nullptr;
+
+    for (int i = 0; i < 3; ++i)
+    {
+        std::unique_ptr<AbstractTyped> clone = value.clone();
+        auto typed = static_cast<Typed<int, AbstractTyped> *>(clone.get());
+        ASSERT_EQ(42, typed->value());
+
+        // The memory of the previous clone is reused
+        if (previous) {
+            ASSERT_EQ(previous, clone.get());
+        }
+
+        previous = clone.get();
+    }
+
+    int stored = 1;
+    StoredValue<int> storedValue([&stored] () { return stored; }, [&stored] (const int & v) { stored = v; });
+    std::unique_ptr<AbstractTyped> storedClone = storedValue.clone();
+    auto storedTyped = static_cast<Typed<int, AbstractTyped> *>(storedClone.get());
+    ASSERT_EQ(1, storedTyped->value());
+
+    Function function(cppassist::make_unique<StaticFunction<int, int>>(&staticFunction));
+    Function copy(function);
+    ASSERT_EQ(4, copy.call({ Variant(2) }).value<int>());
+}
@@ -0,0 +1,96 @@
+
+#include <gmock/gmock.h>
+
+#include <cppassist/memory/make_unique.h>
+
+#include <cppexpose/reflection/Object.h>
+#include <cppexpose/reflection/Property.h>
+
+
+using namespace cppexpose;
+
+
+class PropertyPathTest : public testing::Test
+{
+public:
+    PropertyPathTest()
+    : root("root")
+    , value(0)
+    {
+        auto sub = cppassist::make_unique<Object>("sub");
+        sub->addProperty(cppassist::make_unique<Property<int>>("value", nullptr,
+            [this] () { return value; }, [this] (const int & v) { value = v; }));
+        root.addProperty(std::move(sub));
+    }
+
+
+protected:
+    Object root;
+    int    value;
+};
+
+
+TEST_F(PropertyPathTest, segments)
+{
+    const PropertyPath path("sub..value.");
+
+    ASSERT_EQ("sub..value.", path.str());
+    ASSERT_EQ(2u, path.segments().size());
+    ASSERT_EQ("sub", path.segments()[0].str());
+    ASSERT_EQ("value", path.segments()[1].str());
+
+    ASSERT_TRUE(PropertyPath().isEmpty());
+    ASSERT_TRUE(PropertyPath(".").isEmpty());
+}
+
+TEST_F(PropertyPathTest, resolve)
+{
+    AbstractProperty * property = root.property("sub.value");
+    ASSERT_NE(nullptr, property);
+    ASSERT_EQ("value", property->name());
+
+    const PropertyPath path("sub.value");
+    ASSERT_EQ(property, root.property(path));
+    ASSERT_EQ(property, root.property(path));
+
+    auto sub = static_cast<Object *>(root.property("sub"));
+    ASSERT_EQ(&root, sub->property(PropertyPath("parent")));
+    ASSERT_EQ(property, sub->property(PropertyPath("parent.sub.value")));
+    ASSERT_EQ(property, sub->property("parent.sub.value"));
+
+    // Paths that lead through values or to unknown properties do not resolve
+    ASSERT_EQ(nullptr, root.property(PropertyPath("sub.value.x")));
+    ASSERT_EQ(nullptr, root.property("sub.value.x"));
+    ASSERT_EQ(nullptr, root.property(PropertyPath("sub.unknownName")));
+    ASSERT_EQ(nullptr, root.property("sub.neverUsedName"));
+    ASSERT_EQ(nullptr, root.property(PropertyPath("")));
+    ASSERT_EQ(nullptr, root.property(""));
+}
+
+TEST_F(PropertyPathTest, cacheInvalidation)
+{
+    const PropertyPath path("sub.other");
+    ASSERT_EQ(nullptr, root.property(path));
+
+    auto sub = static_cast<Object *>(root.property("sub"));
+    const auto generation = Object::structureGeneration();
+
+    // Adding a property invalidates the cached result
+    int other = 1;
+    auto property = cppassist::make_unique<Property<int>>("other", nullptr,
+        [&other] () { return other; }, [&other] (const int & v) { other = v; });
+    AbstractProperty * otherProperty = property.get();
+
+    ASSERT_TRUE(sub->addProperty(std::move(property)));
+    ASSERT_NE(generation, Object::structureGeneration());
+    ASSERT_EQ(otherProperty, root.property(path));
+
+    // Removing a property invalidates the cached result
+    ASSERT_TRUE(sub->removeProperty(otherProperty));
+    ASSERT_EQ(nullptr, root.property(path));
+
+    // The cache is bound to the object the path has been resolved from
+    const PropertyPath valuePath("value");
+    ASSERT_EQ(nullptr, root.property(valuePath));
+    ASSERT_NE(nullptr, sub->property(valuePath));
+}
@@ -116,6 +116,153 @@ TEST_F(PropertyTest, ArraySet)
     ASSERT_EQ(10, prop->getElement(0));
 }
 
+TEST_F(PropertyTest, ArraySetElements)
+{
+    Object object;
+
+    std::array<float, 16> value{};
+
+    auto getter = [&value](){return value;};
+    auto setter = [&value](const std::array<float, 16> & arr){value = arr;};
+
+    auto elementGetter = [&value](const int & index) -> float {return value[index];};
+    auto elementSetter = [&value](const int & index, const float & val){value[index] = val;};
+
+    auto prop = cppassist::make_unique<Property<std::array<float, 16>>>("Property", &object, getter, setter, elementGetter, elementSetter);
+
+    int numChanges = 0;
+    prop->valueChanged.connect([&numChanges] (const std::array<float, 16> &) { numChanges++; });
+
+    std::array<float, 16> identity{};
+    for (size_t i = 0; i < 16; i += 5) {
+        identity[i] = 1.0f;
+    }
+
+    // Emits a single notification for all elements
+    ASSERT_EQ(16u, prop->setElements(0, identity.size(), identity.data()));
+    ASSERT_EQ(1, numChanges);
+    ASSERT_EQ(identity, value);
+
+    ASSERT_TRUE(prop->fromString("(1, 0, 0, 0, 0, 2, 0, 0, 0, 0, 3, 0, 0, 0, 0, 4)"));
+    ASSERT_EQ(2, numChanges);
+    ASSERT_EQ(4.0f, value[15]);
+}
+
+namespace
+{
+    struct NotComparable
+    {
+        int value;
+    };
+}
+
+TEST_F(PropertyTest, SetModeIfChanged)
+{
+    Object object;
+
+    int value = 0;
+    auto prop = cppassist::make_unique<Property<int>>("Property", &object, [&value] () { return value; }, [&value] (const int & v) { value = v; });
+
+    int numChanges = 0;
+    prop->valueChanged.connect([&numChanges] (const int &) { numChanges++; });
+
+    ASSERT_EQ(AbstractProperty::SetMode::Default, prop->setMode());
+    ASSERT_FALSE(prop->skipsUnchangedValues());
+
+    // By default, every set is notified
+    prop->setValue(0);
+    ASSERT_EQ(1, numChanges);
+
+    prop->setSetMode(AbstractProperty::SetMode::IfChanged);
+    ASSERT_TRUE(prop->skipsUnchangedValues());
+
+    prop->setValue(0);
+    ASSERT_EQ(1, numChanges);
+
+    prop->setValue(2);
+    prop->setValue(2);
+    ASSERT_EQ(2, numChanges);
+    ASSERT_EQ(2, value);
+}
+
+TEST_F(PropertyTest, SetModeArrayElements)
+{
+    Object object;
+
+    using Vec3 = std::array<float, 3>;
+    Vec3 initial{{ 1.0f, 2.0f, 3.0f }};
+    Vec3 value = initial;
+
+    auto getter = [&value](){return value;};
+    auto setter = [&value](const Vec3 & arr){value = arr;};
+
+    auto elementGetter = [&value](const int & index) -> float {return value[index];};
+    auto elementSetter = [&value](const int & index, const float & val){value[index] = val;};
+
+    auto prop = cppassist::make_unique<Property<Vec3>>("Property", &object, getter, setter, elementGetter, elementSetter);
+    prop->setSetMode(AbstractProperty::SetMode::IfChanged);
+
+    int numChanges = 0;
+    prop->valueChanged.connect([&numChanges] (const Vec3 &) { numChanges++; });
+
+    prop->setValue(initial);
+    prop->setElement(1, 2.0f);
+    ASSERT_EQ(3u, prop->setElements(0, initial.size(), initial.data()));
+    ASSERT_EQ(0, numChanges);
+
+    prop->setElement(1, 5.0f);
+    ASSERT_EQ(1, numChanges);
+    ASSERT_EQ(5.0f, prop->getElement(1));
+}
+
+TEST_F(PropertyTest, SetModeGlobalDefault)
+{
+    Object object;
+
+    string value = "text";
+    auto getter = [&value] () { return value; };
+    auto setter = [&value] (const string & v) { value = v; };
+
+    auto prop = cppassist::make_unique<Property<string>>("Property", &object, getter, setter);
+    auto always = cppassist::make_unique<Property<string>>("Always", &object, getter, setter);
+    always->setSetMode(AbstractProperty::SetMode::Always);
+
+    int numChanges = 0;
+    prop->valueChanged.connect([&numChanges] (const string &) { numChanges++; });
+    always->valueChanged.connect([&numChanges] (const string &) { numChanges++; });
+
+    AbstractProperty::setDefaultSetMode(AbstractProperty::SetMode::IfChanged);
+    ASSERT_EQ(AbstractProperty::SetMode::IfChanged, AbstractProperty::defaultSetMode());
+
+    prop->setValue("text");
+    ASSERT_EQ(0, numChanges);
+
+    always->setValue("text");
+    ASSERT_EQ(1, numChanges);
+
+    AbstractProperty::setDefaultSetMode(AbstractProperty::SetMode::Default);
+    ASSERT_EQ(AbstractProperty::SetMode::Always, AbstractProperty::defaultSetMode());
+
+    prop->setValue("text");
+    ASSERT_EQ(2, numChanges);
+}
+
+TEST_F(PropertyTest, SetModeNotComparable)
+{
+    Object object;
+
+    NotComparable value{ 1 };
+    auto prop = cppassist::make_unique<Property<NotComparable>>("Property", &object, [&value] () { return value; }, [&value] (const NotComparable & v) { value = v; });
+    prop->setSetMode(AbstractProperty::SetMode::IfChanged);
+
+    int numChanges = 0;
+    prop->valueChanged.connect([&numChanges] (const NotComparable &) { numChanges++; });
+
+    // Values without operator== are always considered as changed
+    prop->setValue(NotComparable{ 1 });
+    ASSERT_EQ(1, numChanges);
+}
+
 TEST_F(PropertyTest, stringSet)
 {
     Object object;
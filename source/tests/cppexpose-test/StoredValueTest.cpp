@@ -22,6 +22,41 @@ public:
     }
 };
 
+
+namespace
+{
+    class Data
+    {
+    public:
+        const std::string & name() const { return m_name; }
+        void setName(const std::string & name) { m_name = name; }
+
+        const std::array<float, 4> & values() const { return m_values; }
+        void setValues(const std::array<float, 4> & values) { m_values = values; }
+        float value(int index) const { return m_values[index]; }
+        void setValue(int index, const float & value) { m_values[index] = value; }
+
+    protected:
+        std::string          m_name;
+        std::array<float, 4> m_values;
+    };
+
+    class CountingStringValue : public StoredValue<std::string>
+    {
+    public:
+        using StoredValue<std::string>::StoredValue;
+
+        virtual std::string value() const override
+        {
+            m_copies++;
+            return StoredValue<std::string>::value();
+        }
+
+    public:
+        mutable int m_copies = 0;
+    };
+}
+
 TEST_F(StoredValueTest, boolSet)
 {
     auto value = false;
@@ -80,6 +115,60 @@ TEST_F(StoredValueTest, arraySet)
     ASSERT_EQ(value[0], 10);
 }
 
+TEST_F(StoredValueTest, arrayBulkAccess)
+{
+    std::array<int, 4> value { {1, 2, 3, 4} };
+
+    int numGets = 0;
+    auto getter = [&value, &numGets](){ numGets++; return value; };
+    auto setter = [&value](const std::array<int, 4> & arr){value = arr;};
+
+    auto elementGetter = [&value](const int & index) -> int {return value[index];};
+    auto elementSetter = [&value](const int & index, const int & val){value[index] = val;};
+
+    auto store = StoredValue<std::array<int, 4>>(getter, setter, elementGetter, elementSetter);
+
+    const int elements[] = { 10, 20, 30, 40 };
+    ASSERT_EQ(4u, store.setElements(0, 4, elements));
+
+    // The new value is fetched only once
+    ASSERT_EQ(1, numGets);
+
+    int result[2] = {};
+    ASSERT_EQ(2u, store.getElements(1, 2, result));
+    ASSERT_EQ(20, result[0]);
+    ASSERT_EQ(30, result[1]);
+    ASSERT_EQ("(10, 20, 30, 40)", store.toString());
+}
+
+TEST_F(StoredValueTest, arraySubValues)
+{
+    std::array<int, 3> value { {1, 2, 3} };
+
+    auto getter = [&value](){ return value; };
+    auto setter = [&value](const std::array<int, 3> & arr){value = arr;};
+
+    auto elementGetter = [&value](const int & index) -> int {return value[index];};
+    auto elementSetter = [&value](const int & index, const int & val){value[index] = val;};
+
+    auto store = StoredValue<std::array<int, 3>>(getter, setter, elementGetter, elementSetter);
+
+    ASSERT_EQ(3u, store.numSubValues());
+    ASSERT_EQ(nullptr, store.subValue(3));
+
+    AbstractTyped * element = store.subValue(1);
+    ASSERT_EQ(element, store.subValue(1));
+    ASSERT_EQ("int32", element->typeName());
+    ASSERT_EQ(2, element->toLongLong());
+
+    // Stored elements cannot be accessed in place
+    using IntTyped = Typed<int, AbstractTyped>;
+    ASSERT_EQ(nullptr, static_cast<const IntTyped *>(element)->ptr());
+
+    ASSERT_TRUE(element->fromLongLong(20));
+    ASSERT_EQ(20, value[1]);
+}
+
 TEST_F(StoredValueTest, typesBool)
 {
      bool value = true;
@@ -221,3 +310,56 @@ TEST_F(StoredValueTest, typesArray)
 	ASSERT_FALSE(falseTest);
     ASSERT_EQ(value, store.value());
 }
+
+TEST_F(StoredValueTest, referenceGetter)
+{
+    Data data;
+    data.setName("foo");
+    data.setValues({ { 1.0f, 2.0f, 3.0f, 4.0f } });
+
+    auto name = StoredValue<std::string>(&data, &Data::name, &Data::setName);
+    const auto & constName = name;
+    ASSERT_EQ(&data.name(), constName.ptr());
+    ASSERT_EQ("foo", name.value());
+
+    // The value can only be changed by the setter
+    ASSERT_EQ(nullptr, name.ptr());
+
+    name.setValue("bar");
+    ASSERT_EQ("bar", data.name());
+
+    auto values = StoredValue<std::array<float, 4>>(&data, &Data::values, &Data::setValues, &Data::value, &Data::setValue);
+    const auto & constValues = values;
+    ASSERT_EQ(&data.values(), constValues.ptr());
+    ASSERT_EQ(2.0f, values.getElement(1));
+
+    // Clones keep accessing the value by reference
+    using StringTyped = Typed<std::string, AbstractTyped>;
+
+    auto clone = name.clone();
+    ASSERT_EQ(&data.name(), static_cast<const StringTyped *>(clone.get())->ptr());
+
+    auto readOnly = StoredValue<const std::string>(&data, &Data::name);
+    const auto & constReadOnly = readOnly;
+    ASSERT_EQ(&data.name(), constReadOnly.ptr());
+
+    auto readOnlyClone = readOnly.clone();
+    ASSERT_EQ(&data.name(), static_cast<const StringTyped *>(readOnlyClone.get())->ptr());
+}
+
+TEST_F(StoredValueTest, referenceGetterConversions)
+{
+    Data data;
+    data.setName("42");
+
+    // Conversions read the value through the reference instead of copying it
+    CountingStringValue name(&data, &Data::name, &Data::setName);
+
+    ASSERT_EQ("42", name.toString());
+    ASSERT_EQ(42, name.toLongLong());
+    ASSERT_EQ(42u, name.toULongLong());
+    ASSERT_EQ(42.0, name.toDouble());
+    ASSERT_FALSE(name.toBool());
+    ASSERT_EQ("42", name.toVariant().value<std::string>());
+    ASSERT_EQ(0, name.m_copies);
+}
@@ -0,0 +1,98 @@
+
+#include <atomic>
+#include <string>
+#include <thread>
+#include <unordered_map>
+#include <vector>
+
+#include <gmock/gmock.h>
+
+#include <cppexpose/base/Symbol.h>
+
+
+using namespace cppexpose;
+
+
+class SymbolTest : public testing::Test
+{
+public:
+    SymbolTest()
+    {
+    }
+};
+
+
+TEST_F(SymbolTest, interning)
+{
+    Symbol a(std::string("symbolTestName"));
+    Symbol b("symbolTestName");
+    Symbol c("symbolTestOther");
+
+    ASSERT_EQ(a, b);
+    ASSERT_NE(a, c);
+    ASSERT_EQ(&a.str(), &b.str());
+    ASSERT_EQ("symbolTestName", a.str());
+    ASSERT_EQ(a.hash(), b.hash());
+    ASSERT_TRUE(a < c);
+    ASSERT_FALSE(c < a);
+
+    ASSERT_TRUE(Symbol().empty());
+    ASSERT_EQ(Symbol(), Symbol(""));
+}
+
+TEST_F(SymbolTest, lookup)
+{
+    Symbol symbol;
+
+    ASSERT_FALSE(Symbol::lookup("symbolTestNeverInterned", symbol));
+    ASSERT_TRUE(symbol.empty());
+
+    Symbol interned("symbolTestLookup");
+
+    ASSERT_TRUE(Symbol::lookup("symbolTestLookup", symbol));
+    ASSERT_EQ(interned, symbol);
+}
+
+TEST_F(SymbolTest, growWhileLookingUp)
+{
+    Symbol first("symbolTestGrow0");
+
+    // Look up symbols while the table is grown by interning many new strings
+    std::atomic<bool> found(true);
+
+    std::thread reader([&first, &found] ()
+    {
+        for (int i = 0; i < 10000 && found; i++)
+        {
+            Symbol symbol;
+            found = Symbol::lookup("symbolTestGrow0", symbol) && symbol == first;
+        }
+    });
+
+    std::vector<Symbol> symbols;
+    for (int i = 1; i < 5000; i++) {
+        symbols.emplace_back("symbolTestGrow" + std::to_string(i));
+    }
+
+    reader.join();
+    ASSERT_TRUE(found);
+
+    for (int i = 1; i < 5000; i++)
+    {
+        Symbol symbol;
+        ASSERT_TRUE(Symbol::lookup("symbolTestGrow" + std::to_string(i), symbol));
+        ASSERT_EQ(symbols[i - 1], symbol);
+    }
+
+    ASSERT_EQ(first, Symbol(std::string("symbolTestGrow0")));
+}
+
+TEST_F(SymbolTest, hashMap)
+{
+    std::unordered_map<Symbol, int> map;
+    map[Symbol("one")] = 1;
+    map[Symbol("two")] = 2;
+
+    ASSERT_EQ(1, map[Symbol(std::string("one"))]);
+    ASSERT_EQ(2u, map.size());
+}
@@ -0,0 +1,112 @@
+
+#include <gmock/gmock.h>
+
+#include <array>
+#include <string>
+#include <vector>
+
+#include <cppexpose/reflection/Object.h>
+#include <cppexpose/reflection/Property.h>
+#include <cppexpose/typed/DirectValue.h>
+#include <cppexpose/typed/StoredValue.h>
+
+
+using namespace cppexpose;
+
+
+class TypeDescriptorTest : public testing::Test
+{
+public:
+    TypeDescriptorTest()
+    {
+    }
+
+    void expectFlags(const AbstractTyped & value)
+    {
+        const TypeDescriptor & descriptor = value.typeDescriptor();
+
+        EXPECT_EQ(value.typeName(), descriptor.name());
+        EXPECT_EQ(value.type(), descriptor.type());
+        EXPECT_EQ(value.isEnum(), descriptor.is(TypeDescriptor::Enum));
+        EXPECT_EQ(value.isArray(), descriptor.is(TypeDescriptor::Array));
+        EXPECT_EQ(value.isVariant(), descriptor.is(TypeDescriptor::Variant));
+        EXPECT_EQ(value.isString(), descriptor.is(TypeDescriptor::String));
+        EXPECT_EQ(value.isBool(), descriptor.is(TypeDescriptor::Bool));
+        EXPECT_EQ(value.isNumber(), descriptor.is(TypeDescriptor::Number));
+        EXPECT_EQ(value.isIntegral(), descriptor.is(TypeDescriptor::Integral));
+        EXPECT_EQ(value.isSignedIntegral(), descriptor.is(TypeDescriptor::SignedIntegral));
+        EXPECT_EQ(value.isUnsignedIntegral(), descriptor.is(TypeDescriptor::UnsignedIntegral));
+        EXPECT_EQ(value.isFloatingPoint(), descriptor.is(TypeDescriptor::FloatingPoint));
+        EXPECT_EQ(value.isComposite(), descriptor.is(TypeDescriptor::Composite));
+    }
+};
+
+
+namespace
+{
+    enum class Mode
+    {
+        Fast,
+        Nice
+    };
+
+    struct Unknown
+    {
+        int value;
+    };
+}
+
+
+TEST_F(TypeDescriptorTest, flagsMatchTypedValues)
+{
+    expectFlags(DirectValue<bool>(true));
+    expectFlags(DirectValue<int>(1));
+    expectFlags(DirectValue<unsigned char>(1));
+    expectFlags(DirectValue<float>(1.0f));
+    expectFlags(DirectValue<double>(1.0));
+    expectFlags(DirectValue<std::string>("text"));
+    expectFlags(DirectValue<Mode>(Mode::Fast));
+    expectFlags(DirectValue<Variant>(Variant(1)));
+    expectFlags(DirectValue<Unknown>(Unknown{ 1 }));
+    expectFlags(DirectValue<std::array<int, 3>>());
+    expectFlags(DirectValue<std::vector<double>>());
+    expectFlags(Object("object"));
+}
+
+TEST_F(TypeDescriptorTest, names)
+{
+    ASSERT_EQ("int16", DirectValue<short>().typeDescriptor().name());
+    ASSERT_EQ("uint64", DirectValue<unsigned long long>().typeDescriptor().name());
+    ASSERT_EQ("float", DirectValue<float>().typeDescriptor().name());
+    ASSERT_EQ("double", DirectValue<double>().typeDescriptor().name());
+
+    using Vec4 = std::array<float, 4>;
+    ASSERT_EQ("array<float, 4>", DirectValue<Vec4>().typeName());
+    ASSERT_EQ("vector<string>", DirectValue<std::vector<std::string>>().typeName());
+}
+
+TEST_F(TypeDescriptorTest, elementType)
+{
+    using Vec4 = std::array<float, 4>;
+
+    const TypeDescriptor & descriptor = DirectValue<Vec4>().typeDescriptor();
+
+    ASSERT_EQ(sizeof(Vec4), descriptor.size());
+    ASSERT_EQ(4u, descriptor.numElements());
+    ASSERT_EQ(&DirectValue<float>().typeDescriptor(), descriptor.elementType());
+
+    ASSERT_EQ(nullptr, DirectValue<int>().typeDescriptor().elementType());
+}
+
+TEST_F(TypeDescriptorTest, sharedByAllValues)
+{
+    Object object;
+
+    int value = 0;
+    auto prop = cppassist::make_unique<Property<int>>("prop", &object, [&value] () { return value; }, [&value] (const int & v) { value = v; });
+    StoredValue<int> stored([&value] () { return value; }, [&value] (const int & v) { value = v; });
+    DirectValue<int> direct(1);
+
+    ASSERT_EQ(&direct.typeDescriptor(), &stored.typeDescriptor());
+    ASSERT_EQ(&direct.typeDescriptor(), &prop->typeDescriptor());
+}
@@ -0,0 +1,101 @@
+
+#include <gmock/gmock.h>
+
+#include <cppexpose/reflection/Object.h>
+#include <cppexpose/reflection/Property.h>
+#include <cppexpose/typed/DirectValue.h>
+
+
+using namespace cppexpose;
+
+
+class TypedEnumTest : public testing::Test
+{
+public:
+    TypedEnumTest()
+    {
+    }
+};
+
+
+namespace
+{
+    enum class Color
+    {
+        Red,
+        Green,
+        Blue
+    };
+}
+
+
+namespace cppexpose
+{
+    template <>
+    struct EnumDefaultStrings<Color>
+    {
+        std::map<Color, std::string> operator()()
+        {
+            return {
+                { Color::Red,   "red" },
+                { Color::Green, "green" },
+                { Color::Blue,  "blue" }
+            };
+        }
+    };
+}
+
+
+TEST_F(TypedEnumTest, defaultStrings)
+{
+    DirectValue<Color> value(Color::Green);
+
+    ASSERT_EQ("green", value.toString());
+    ASSERT_EQ((std::vector<std::string>{ "red", "green", "blue" }), value.strings());
+
+    ASSERT_TRUE(value.fromString("blue"));
+    ASSERT_EQ(Color::Blue, value.value());
+
+    ASSERT_FALSE(value.fromString("yellow"));
+    ASSERT_EQ(Color::Blue, value.value());
+}
+
+TEST_F(TypedEnumTest, setStrings)
+{
+    DirectValue<Color> value(Color::Red);
+    DirectValue<Color> other(Color::Red);
+
+    value.setStrings({ { Color::Red, "rot" }, { Color::Green, "gruen" } });
+
+    ASSERT_EQ("rot", value.toString());
+    ASSERT_TRUE(value.fromString("gruen"));
+    ASSERT_EQ(Color::Green, value.value());
+
+    ASSERT_FALSE(value.fromString("blue"));
+
+    value.setValue(Color::Blue);
+    ASSERT_EQ("", value.toString());
+
+    // Other values keep the default strings
+    ASSERT_EQ("red", other.toString());
+}
+
+TEST_F(TypedEnumTest, sharedOptions)
+{
+    Object object;
+
+    Color color = Color::Red;
+    auto getter = [&color] () { return color; };
+    auto setter = [&color] (const Color & value) { color = value; };
+
+    auto first  = cppassist::make_unique<Property<Color>>("first", &object, getter, setter);
+    auto second = cppassist::make_unique<Property<Color>>("second", &object, getter, setter);
+
+    const Variant & choices = first->option("choices");
+    ASSERT_EQ(3u, choices.asArray()->size());
+    ASSERT_EQ("blue", choices.asArray()->at(2).value<std::string>());
+
+    // The choices are not copied for each property
+    ASSERT_TRUE(choices.isShared());
+    ASSERT_EQ(choices.asArray(), second->option("choices").asArray());
+}
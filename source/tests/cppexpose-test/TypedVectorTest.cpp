@@ -0,0 +1,175 @@
+
+#include <gmock/gmock.h>
+
+#include <vector>
+
+#include <cppexpose/reflection/Object.h>
+#include <cppexpose/reflection/Property.h>
+#include <cppexpose/typed/DirectValue.h>
+#include <cppexpose/typed/StoredValue.h>
+#include <cppexpose/variant/Variant.h>
+
+
+using namespace cppexpose;
+
+
+class TypedVectorTest : public testing::Test
+{
+public:
+    TypedVectorTest()
+    {
+    }
+};
+
+
+namespace
+{
+    class Buffer
+    {
+    public:
+        const std::vector<float> & data() const
+        {
+            return m_data;
+        }
+
+        void setData(const std::vector<float> & data)
+        {
+            m_data = data;
+        }
+
+    protected:
+        std::vector<float> m_data;
+    };
+}
+
+
+TEST_F(TypedVectorTest, directValue)
+{
+    DirectValue<std::vector<int>> value(std::vector<int>{ 1, 2, 3 });
+
+    ASSERT_TRUE(value.isArray());
+    ASSERT_EQ("vector<int32>", value.typeName());
+    ASSERT_EQ(3u, value.numElements());
+    ASSERT_EQ(2, value.getElement(1));
+
+    value.resize(5);
+    ASSERT_EQ(5u, value.numElements());
+    ASSERT_EQ(0, value.getElement(4));
+
+    const int elements[] = { 10, 20, 30 };
+    ASSERT_EQ(2u, value.setElements(3, 3, elements));
+    ASSERT_EQ(20, value.getElement(4));
+
+    // Elements are changed in place
+    ASSERT_EQ(value.ptr()->data() + 3, &(*value.ptr())[3]);
+    ASSERT_EQ("(1, 2, 3, 10, 20)", value.toString());
+
+    ASSERT_TRUE(value.fromString(" (4,5 , 6) "));
+    ASSERT_EQ((std::vector<int>{ 4, 5, 6 }), value.value());
+
+    ASSERT_TRUE(value.fromString("()"));
+    ASSERT_EQ(0u, value.numElements());
+
+    // Invalid strings do not change the vector
+    value.setValue(std::vector<int>{ 1 });
+    ASSERT_FALSE(value.fromString("(1, 2,)"));
+    ASSERT_FALSE(value.fromString("1, 2"));
+    ASSERT_EQ(1u, value.numElements());
+}
+
+TEST_F(TypedVectorTest, vectorTypes)
+{
+    // Vectors of strings are typed vectors, so they are arrays
+    const std::vector<std::string> strings{ "a", "b" };
+    ASSERT_EQ("vector<string>", DirectValue<std::vector<std::string>>(strings).typeName());
+    ASSERT_TRUE(DirectValue<std::vector<std::string>>(strings).isArray());
+    ASSERT_TRUE(Variant(strings).isArray());
+
+    // Variant arrays are not
+    ASSERT_FALSE(DirectValue<VariantArray>().isArray());
+    ASSERT_FALSE(Variant(VariantArray()).isArray());
+    ASSERT_TRUE(Variant(VariantArray()).isVariantArray());
+}
+
+TEST_F(TypedVectorTest, storedValue)
+{
+    Buffer buffer;
+    buffer.setData(std::vector<float>{ 1.0f, 2.0f });
+
+    StoredValue<std::vector<float>> value(&buffer, &Buffer::data, &Buffer::setData);
+
+    ASSERT_EQ(2u, value.numElements());
+    ASSERT_EQ(2.0f, value.getElement(1));
+
+    value.setElement(0, 3.0f);
+    ASSERT_EQ(3.0f, buffer.data()[0]);
+
+    value.resize(3);
+    ASSERT_EQ(3u, buffer.data().size());
+
+    float elements[3] = {};
+    ASSERT_EQ(3u, value.getElements(0, 3, elements));
+    ASSERT_EQ(3.0f, elements[0]);
+    ASSERT_EQ(0.0f, elements[2]);
+}
+
+TEST_F(TypedVectorTest, storedValueByValue)
+{
+    std::vector<int> data{ 1, 2, 3 };
+    int numReads = 0;
+
+    StoredValue<std::vector<int>> value(
+        [&data, &numReads] () { numReads++; return data; },
+        [&data] (const std::vector<int> & values) { data = values; });
+
+    // The vector is fetched only once, not once per element
+    ASSERT_EQ("(1, 2, 3)", value.toString());
+    ASSERT_EQ(1, numReads);
+
+    int elements[3] = {};
+    ASSERT_EQ(3u, value.getElements(0, 3, elements));
+    ASSERT_EQ(3, elements[2]);
+    ASSERT_EQ(2, numReads);
+}
+
+TEST_F(TypedVectorTest, propertyNotifications)
+{
+    Object object;
+
+    std::vector<double> data{ 0.0, 0.0, 0.0, 0.0 };
+
+    auto prop = cppassist::make_unique<Property<std::vector<double>>>("Property", &object,
+        [&data] () { return data; },
+        [&data] (const std::vector<double> & values) { data = values; });
+
+    int numChanges = 0;
+    prop->valueChanged.connect([&numChanges] (const std::vector<double> &) { numChanges++; });
+
+    const double elements[] = { 1.0, 2.0, 3.0, 4.0 };
+    ASSERT_EQ(4u, prop->setElements(0, 4, elements));
+    ASSERT_EQ(1, numChanges);
+    ASSERT_EQ(4.0, data[3]);
+}
+
+TEST_F(TypedVectorTest, variantConversion)
+{
+    DirectValue<std::vector<float>> value(std::vector<float>{ 1.0f, 2.5f });
+
+    // Numeric vectors are converted into packed arrays
+    Variant variant = value.toVariant();
+    ASSERT_TRUE(variant.isPackedArray());
+    ASSERT_EQ("[1,2.5]", variant.toJSON());
+
+    // Variant arrays are converted element-wise
+    ASSERT_TRUE(value.fromVariant(Variant(VariantArray{ Variant(3), Variant(4.5) })));
+    ASSERT_EQ((std::vector<float>{ 3.0f, 4.5f }), value.value());
+
+    ASSERT_FALSE(value.fromVariant(Variant(1)));
+
+    // Vectors of other types are converted into variant arrays
+    DirectValue<std::vector<bool>> flags(std::vector<bool>{ true, false });
+    Variant array = flags.toVariant();
+    ASSERT_TRUE(array.isVariantArray());
+    ASSERT_EQ(2u, array.asArray()->size());
+    ASSERT_FALSE(array.asArray()->at(1).value<bool>());
+}
@@ -0,0 +1,202 @@
+
+#include <cstdint>
+#include <cstdio>
+#include <cstring>
+#include <string>
+#include <vector>
+
+#include <gmock/gmock.h>
+
+#include <cppexpose/json/JSON.h>
+#include <cppexpose/variant/VariantDocument.h>
+
+
+using namespace cppexpose;
+
+
+class VariantDocumentTest : public testing::Test
+{
+public:
+    VariantDocumentTest()
+    {
+    }
+
+    static Variant dataset()
+    {
+        Variant value;
+        JSON::parse(value, "{\"name\": \"dataset\", \"count\": -3, \"scale\": 0.5, \"valid\": true, \"none\": null,"
+                           " \"list\": [1, \"two\", [3], {\"four\": 4}], \"nested\": {\"a\": {\"b\": \"c\"}}}");
+
+        (*value.asMap())["points"] = std::vector<float>{ 1.0f, 2.0f, 3.0f };
+        (*value.asMap())["ids"]    = std::vector<std::int64_t>{ -1, 1ll << 40 };
+        (*value.asMap())["tags"]   = std::vector<std::string>{ "x", "y" };
+        (*value.asMap())["flags"]  = static_cast<unsigned char>(200);
+        return value;
+    }
+
+    // Create a document of nested arrays whose elements all reference the previous array
+    static std::vector<std::uint8_t> nestedArrays(unsigned int depth, unsigned int elements)
+    {
+        std::vector<std::uint8_t> data(16, 0);
+
+        const std::uint16_t version = 1;
+        const std::uint16_t byteOrderMark = 0x0102;
+        std::memcpy(&data[0], "CPXD", 4);
+        std::memcpy(&data[4], &version, sizeof(version));
+        std::memcpy(&data[6], &byteOrderMark, sizeof(byteOrderMark));
+
+        std::uint64_t offset = 0;
+
+        for (unsigned int level = 0; level <= depth; ++level)
+        {
+            const std::uint64_t count    = level == 0 ? 0 : elements;
+            const std::uint64_t previous = offset;
+
+            offset = data.size();
+            data.resize(data.size() + 16 + count * 8, 0);
+            data[offset] = static_cast<std::uint8_t>(VariantType::VariantArray);
+            std::memcpy(&data[offset + 8], &count, sizeof(count));
+
+            for (std::uint64_t i = 0; i < count; ++i) {
+                std::memcpy(&data[offset + 16 + i * 8], &previous, sizeof(previous));
+            }
+        }
+
+        std::memcpy(&data[8], &offset, sizeof(offset));
+        return data;
+    }
+};
+
+
+TEST_F(VariantDocumentTest, accessValues)
+{
+    const std::vector<std::uint8_t> data = VariantDocument::encode(dataset());
+
+    VariantDocument document;
+    ASSERT_TRUE(document.open(data.data(), data.size()));
+
+    const DocumentValue root = document.root();
+    ASSERT_TRUE(root.isVariantMap());
+    ASSERT_EQ(11u, root.size());
+
+    ASSERT_STREQ("dataset", root.find("name").c_str());
+    ASSERT_EQ(-3, root.find("count").toLongLong());
+    ASSERT_EQ(0.5, root.find("scale").toDouble());
+    ASSERT_TRUE(root.find("valid").toBool());
+    ASSERT_TRUE(root.find("none").isNull());
+    ASSERT_TRUE(root.find("missing").isNull());
+    ASSERT_EQ(VariantType::UnsignedChar, root.find("flags").variantType());
+    ASSERT_EQ(200u, root.find("flags").toULongLong());
+
+    const DocumentValue list = root.find("list");
+    ASSERT_TRUE(list.isVariantArray());
+    ASSERT_EQ(4u, list.size());
+    ASSERT_EQ("two", list.at(1).toString());
+    ASSERT_EQ(3, list.at(2).at(0).toLongLong());
+    ASSERT_EQ(4, list.at(3).find("four").toLongLong());
+    ASSERT_TRUE(list.at(4).isNull());
+
+    ASSERT_EQ("c", root.find("nested").find("a").find("b").toString());
+    ASSERT_EQ("y", root.find("tags").at(1).toString());
+
+    // Packed arrays are accessed in place
+    const DocumentValue points = root.find("points");
+    ASSERT_TRUE(points.isPackedArray());
+    ASSERT_EQ(3u, points.size());
+    ASSERT_EQ(nullptr, points.data<double>());
+    ASSERT_EQ(2.0f, points.data<float>()[1]);
+    ASSERT_EQ(1ll << 40, root.find("ids").data<std::int64_t>()[1]);
+
+    // Strings point into the document
+    const char * name = root.find("name").c_str();
+    ASSERT_TRUE(reinterpret_cast<const std::uint8_t *>(name) > data.data());
+    ASSERT_TRUE(reinterpret_cast<const std::uint8_t *>(name) < data.data() + data.size());
+
+    // Map entries are sorted by key
+    ASSERT_EQ("count", root.keyAt(0).toString());
+    ASSERT_EQ(-3, root.at(0).toLongLong());
+}
+
+TEST_F(VariantDocumentTest, toVariant)
+{
+    const Variant value = dataset();
+    const std::vector<std::uint8_t> data = VariantDocument::encode(value);
+
+    VariantDocument document;
+    ASSERT_TRUE(document.open(data.data(), data.size()));
+
+    const Variant copy = document.root().toVariant();
+    ASSERT_EQ(value, copy);
+    ASSERT_EQ(VariantType::Int64Vector, (*copy.asMap()).at("ids").variantType());
+}
+
+TEST_F(VariantDocumentTest, saveAndLoad)
+{
+    const std::string filename = "VariantDocumentTest.bin";
+    ASSERT_TRUE(VariantDocument::save(dataset(), filename));
+
+    {
+        VariantDocument document;
+        ASSERT_TRUE(document.load(filename));
+        ASSERT_TRUE(document.isValid());
+        ASSERT_EQ(VariantDocument::encode(dataset()).size(), document.size());
+        ASSERT_EQ(3.0f, document.root().find("points").data<float>()[2]);
+
+        document.close();
+        ASSERT_FALSE(document.isValid());
+        ASSERT_TRUE(document.root().isNull());
+    }
+
+    std::remove(filename.c_str());
+
+    VariantDocument document;
+    ASSERT_FALSE(document.load(filename));
+}
+
+TEST_F(VariantDocumentTest, invalidData)
+{
+    std::vector<std::uint8_t> data = VariantDocument::encode(dataset());
+    VariantDocument document;
+
+    // Invalid header
+    ASSERT_FALSE(document.open(data.data(), 8));
+
+    std::vector<std::uint8_t> invalid = data;
+    invalid[0] = 'X';
+    ASSERT_FALSE(document.open(invalid.data(), invalid.size()));
+
+    // Truncated document (the root value is stored at the end)
+    ASSERT_FALSE(document.open(data.data(), data.size() - 1));
+
+    // Cyclic offsets are rejected
+    Variant array = VariantArray{ 1 };
+    std::vector<std::uint8_t> cyclic = VariantDocument::encode(array);
+
+    const std::uint64_t offset = cyclic.size() - 24;
+    std::memcpy(&cyclic[cyclic.size() - 8], &offset, sizeof(offset));
+
+    ASSERT_TRUE(document.open(cyclic.data(), cyclic.size()));
+    ASSERT_EQ(1u, document.root().size());
+    ASSERT_TRUE(document.root().at(0).isNull());
+}
+
+TEST_F(VariantDocumentTest, limitCopies)
+{
+    VariantDocument document;
+
+    std::vector<std::uint8_t> nested = nestedArrays(100, 1);
+    ASSERT_TRUE(document.open(nested.data(), nested.size()));
+    ASSERT_TRUE(document.root().toVariant().isVariantArray());
+
+    // Deeply nested values are not copied
+    std::vector<std::uint8_t> deep = nestedArrays(100000, 1);
+    ASSERT_TRUE(document.open(deep.data(), deep.size()));
+    ASSERT_TRUE(document.root().at(0).isVariantArray());
+    ASSERT_TRUE(document.root().toVariant().isNull());
+
+    // Values that are referenced multiple times are not expanded exponentially
+    std::vector<std::uint8_t> shared = nestedArrays(64, 2);
+    ASSERT_TRUE(document.open(shared.data(), shared.size()));
+    ASSERT_EQ(2u, document.root().size());
+    ASSERT_TRUE(document.root().toVariant().isNull());
+}
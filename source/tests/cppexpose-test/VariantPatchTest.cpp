@@ -0,0 +1,130 @@
+
+#include <string>
+
+#include <gmock/gmock.h>
+
+#include <cppexpose/json/JSON.h>
+#include <cppexpose/reflection/DynamicProperty.h>
+#include <cppexpose/reflection/Object.h>
+#include <cppexpose/variant/VariantPatch.h>
+
+
+using namespace cppexpose;
+
+
+class VariantPatchTest : public testing::Test
+{
+public:
+    VariantPatchTest()
+    {
+    }
+
+    static Variant parse(const std::string & json)
+    {
+        Variant value;
+        JSON::parse(value, json);
+        return value;
+    }
+};
+
+
+TEST_F(VariantPatchTest, diffAndApply)
+{
+    const Variant from = parse("{\"a\": 1, \"b\": {\"c\": \"x\", \"d\": [1, 2]}, \"e\": true}");
+    const Variant to   = parse("{\"a\": 1, \"b\": {\"c\": \"y\", \"d\": [1, 2]}, \"f\": 2.5}");
+
+    VariantPatch patch = VariantPatch::diff(from, to);
+    ASSERT_EQ(3u, patch.changes().size());
+
+    const auto & changes = patch.changes();
+    ASSERT_EQ(VariantPatch::Operation::Replace, changes[0].operation);
+    ASSERT_EQ(std::vector<std::string>({ "b", "c" }), changes[0].path);
+    ASSERT_EQ(Variant("y"), changes[0].value);
+    ASSERT_EQ(VariantPatch::Operation::Remove, changes[1].operation);
+    ASSERT_EQ(std::vector<std::string>({ "e" }), changes[1].path);
+    ASSERT_EQ(VariantPatch::Operation::Add, changes[2].operation);
+    ASSERT_EQ(std::vector<std::string>({ "f" }), changes[2].path);
+
+    Variant target = from;
+    ASSERT_TRUE(patch.apply(target));
+    ASSERT_EQ(to, target);
+
+    ASSERT_TRUE(VariantPatch::diff(to, to).empty());
+
+    // Values that are not maps are replaced as a whole
+    VariantPatch rootPatch = VariantPatch::diff(Variant(1), to);
+    ASSERT_EQ(1u, rootPatch.changes().size());
+    ASSERT_TRUE(rootPatch.changes()[0].path.empty());
+
+    // Changes to paths that do not exist fail
+    Variant other = parse("{\"a\": 1}");
+    ASSERT_FALSE(patch.apply(other));
+}
+
+TEST_F(VariantPatchTest, applyToSharedTree)
+{
+    Variant from = parse("{\"a\": {\"x\": 1}, \"b\": {\"y\": 2}}");
+    (*from.asMap())["a"].share();
+    (*from.asMap())["b"].share();
+    from.share();
+
+    Variant to = from;
+    (*(*to.asMap())["b"].asMap())["y"] = 3;
+
+    // The unchanged subtree is still shared after applying the patch
+    Variant target = from;
+    ASSERT_TRUE(VariantPatch::diff(from, to).apply(target));
+    ASSERT_EQ(to, target);
+    const Variant & constFrom   = from;
+    const Variant & constTarget = target;
+    ASSERT_EQ(constFrom.asMap()->find("a")->second.asMap(), constTarget.asMap()->find("a")->second.asMap());
+}
+
+TEST_F(VariantPatchTest, variantRepresentation)
+{
+    const Variant from = parse("{\"a\": 1, \"b\": {\"c\": \"x\"}}");
+    const Variant to   = parse("{\"b\": {\"c\": \"y\"}, \"d\": [1]}");
+
+    const VariantPatch patch = VariantPatch::diff(from, to);
+    const VariantPatch restored = VariantPatch::fromVariant(parse(patch.toVariant().toJSON()));
+
+    ASSERT_EQ(patch.changes().size(), restored.changes().size());
+
+    Variant target = from;
+    ASSERT_TRUE(restored.apply(target));
+    ASSERT_EQ(to, target);
+
+    ASSERT_TRUE(VariantPatch::fromVariant(parse("[{\"op\": \"unknown\"}]")).empty());
+}
+
+TEST_F(VariantPatchTest, applyToObject)
+{
+    Object root("root");
+    Object child("child");
+    root.addProperty(&child);
+
+    DynamicProperty<int> a("a", &root, 1);
+    DynamicProperty<std::string> b("b", &child, "x");
+    DynamicProperty<Variant> c("c", &child, parse("{\"d\": 1, \"e\": 2}"));
+
+    int changedA = 0;
+    int changedB = 0;
+    a.valueChanged.connect([&changedA] (const int &) { changedA++; });
+    b.valueChanged.connect([&changedB] (const std::string &) { changedB++; });
+
+    const Variant from = root.toVariant();
+    Variant to = from;
+    (*(*to.asMap())["child"].asMap())["b"] = "y";
+    (*(*(*to.asMap())["child"].asMap())["c"].asMap())["e"] = 3;
+
+    ASSERT_TRUE(root.applyPatch(VariantPatch::diff(from, to)));
+    ASSERT_EQ(0, changedA);
+    ASSERT_EQ(1, changedB);
+    ASSERT_EQ("y", b.value());
+    ASSERT_EQ(parse("{\"d\": 1, \"e\": 3}"), c.value());
+    ASSERT_EQ(to, root.toVariant());
+
+    VariantPatch patch;
+    patch.addChange(VariantPatch::Operation::Replace, { "child", "unknown" }, 1);
+    ASSERT_FALSE(root.applyPatch(patch));
+}
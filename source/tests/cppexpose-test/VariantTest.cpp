@@ -1,9 +1,13 @@
 
+#include <array>
+#include <limits>
 #include <utility>
 
 #include <gmock/gmock.h>
 
+#include <cppexpose/typed/DirectValue.h>
 #include <cppexpose/variant/Variant.h>
+#include <cppexpose/json/JSON.h>
 
 
 using namespace cppexpose;
@@ -165,3 +169,248 @@ TEST_F(variantTest, staticConstructorVariantMap)
     
     testType(var, &Variant::isVariantMap, methods);
 }
+
+TEST_F(variantTest, copyInlineValues)
+{
+    auto var = Variant(std::string("test"));
+    auto copy = var;
+
+    var = Variant(42);
+
+    testType(copy, &Variant::isString, methods);
+    ASSERT_EQ("test", copy.value<std::string>());
+    ASSERT_EQ(42, var.value<int>());
+
+    copy = copy;
+    ASSERT_EQ("test", copy.value<std::string>());
+
+    *copy.ptr<std::string>() = "changed";
+    ASSERT_EQ("changed", copy.toString());
+}
+
+TEST_F(variantTest, copyCompositeValues)
+{
+    auto var = Variant::map();
+    (*var.asMap())["value"] = Variant(std::string("test"));
+
+    auto copy = var;
+    (*var.asMap())["value"] = 10;
+
+    testType(copy, &Variant::isVariantMap, methods);
+    ASSERT_EQ("test", (*copy.asMap())["value"].value<std::string>());
+    ASSERT_EQ(10, (*var.asMap())["value"].value<int>());
+}
+
+TEST_F(variantTest, moveValues)
+{
+    auto var = Variant(std::string("test"));
+    auto moved = std::move(var);
+
+    testType(var, &Variant::isNull, methods);
+    testType(moved, &Variant::isString, methods);
+    ASSERT_EQ("test", moved.value<std::string>());
+
+    auto map = Variant::map();
+    (*map.asMap())["value"] = 10;
+    const VariantMap * data = map.asMap();
+
+    var = std::move(map);
+
+    testType(map, &Variant::isNull, methods);
+    testType(var, &Variant::isVariantMap, methods);
+    ASSERT_EQ(data, var.asMap());
+    ASSERT_EQ(10, (*var.asMap())["value"].value<int>());
+}
+
+TEST_F(variantTest, shareCompositeValues)
+{
+    auto var = Variant::map();
+    (*var.asMap())["value"] = 10;
+
+    ASSERT_FALSE(var.isShared());
+    var.share();
+    ASSERT_TRUE(var.isShared());
+
+    const Variant copy = var;
+    ASSERT_TRUE(copy.isShared());
+    ASSERT_EQ(static_cast<const Variant &>(var).asMap(), copy.asMap());
+
+    (*var.asMap())["value"] = 20;
+
+    testType(var, &Variant::isVariantMap, methods);
+    ASSERT_NE(static_cast<const Variant &>(var).asMap(), copy.asMap());
+    ASSERT_EQ(20, var.asMap()->at("value").value<int>());
+    ASSERT_EQ(10, copy.asMap()->at("value").value<int>());
+
+    auto number = Variant(10);
+    number.share();
+    ASSERT_FALSE(number.isShared());
+}
+
+TEST_F(variantTest, variantType)
+{
+    ASSERT_EQ(VariantType::Null,         Variant().variantType());
+    ASSERT_EQ(VariantType::Bool,         Variant(true).variantType());
+    ASSERT_EQ(VariantType::UnsignedChar, Variant(static_cast<unsigned char>(1)).variantType());
+    ASSERT_EQ(VariantType::Int,          Variant(1).variantType());
+    ASSERT_EQ(VariantType::Double,       Variant(1.0).variantType());
+    ASSERT_EQ(VariantType::String,       Variant("test").variantType());
+    ASSERT_EQ(VariantType::VariantArray, Variant::array().variantType());
+    ASSERT_EQ(VariantType::VariantMap,   Variant::map().variantType());
+
+    using IntArray = std::array<int, 3>;
+
+    auto var = Variant::fromValue(IntArray{{1, 2, 3}});
+    ASSERT_EQ(VariantType::Other, var.variantType());
+    ASSERT_TRUE(var.hasType<IntArray>());
+    ASSERT_FALSE(var.hasType<int>());
+    testType(var, &Variant::isArray, methods);
+    ASSERT_EQ(2, var.value<IntArray>()[1]);
+
+    auto copy = var;
+    ASSERT_EQ(VariantType::Other, copy.variantType());
+    ASSERT_EQ(3, copy.ptr<IntArray>()->at(2));
+}
+
+TEST_F(variantTest, packedArray)
+{
+    auto var = Variant(std::vector<float>{1.5f, 2.0f, 3.0f});
+
+    ASSERT_EQ(VariantType::FloatVector, var.variantType());
+    ASSERT_TRUE(var.isPackedArray());
+    ASSERT_FALSE(var.isVariantArray());
+    ASSERT_TRUE(var.isArray());
+    ASSERT_EQ(DirectValue<std::vector<float>>().isArray(), var.isArray());
+    ASSERT_EQ(nullptr, var.asArray());
+    ASSERT_EQ(3u, var.ptr<std::vector<float>>()->size());
+
+    std::vector<float> floats = var.toVector<float>();
+    ASSERT_EQ(1.5f, floats[0]);
+
+    std::vector<int> ints = var.toVector<int>();
+    ASSERT_EQ(1, ints[0]);
+    ASSERT_EQ(3, ints[2]);
+
+    ASSERT_EQ("[1.5,2,3]", var.toJSON());
+    ASSERT_EQ("[1,255]", Variant(std::vector<std::uint8_t>{1, 255}).toJSON());
+
+    auto map = Variant::map();
+    (*map.asMap())["data"] = Variant(std::vector<std::int32_t>{1, 2});
+    ASSERT_EQ("{\"data\":[1,2]}", map.toJSON());
+}
+
+TEST_F(variantTest, scalarConversion)
+{
+    // Numbers are converted like the typed values they are stored in
+    ASSERT_EQ(2, Variant(2.7).value<int>());
+    ASSERT_EQ(-2, Variant(-2.7f).value<long long>());
+    ASSERT_EQ(300u, Variant(300).value<unsigned int>());
+    ASSERT_EQ(static_cast<unsigned char>(300), Variant(300).value<unsigned char>());
+    ASSERT_EQ(1.0, Variant(true).value<double>());
+    ASSERT_TRUE(Variant(0.5).value<bool>());
+    ASSERT_FALSE(Variant(0).value<bool>());
+    ASSERT_EQ(DirectValue<double>(1e20).convert<float>(), Variant(1e20).value<float>());
+    ASSERT_EQ(DirectValue<long long>(-1).convert<unsigned int>(), Variant(-1ll).value<unsigned int>());
+
+    // Number to string
+    ASSERT_EQ("42", Variant(42).value<std::string>());
+    ASSERT_EQ("-42", Variant(-42ll).toString());
+    ASSERT_EQ("18446744073709551615", Variant(18446744073709551615ull).toString());
+    ASSERT_EQ("0.1", Variant(0.1).value<std::string>());
+    ASSERT_EQ("1.5", Variant(1.5f).toString());
+    ASSERT_EQ("1e+20", Variant(1e20).toString());
+    ASSERT_EQ("true", Variant(true).toString());
+    ASSERT_EQ("a", Variant('a').toString());
+
+    // String to number
+    ASSERT_EQ(42, Variant("42").value<int>());
+    ASSERT_EQ(-7, Variant(" -7xyz").toLongLong());
+    ASSERT_EQ(1.25, Variant("1.25").value<double>());
+    ASSERT_EQ(1e3, Variant("1e3").toDouble());
+    ASSERT_EQ(2.0, Variant("2e").toDouble());
+    ASSERT_EQ(0.0, Variant("abc").toDouble());
+    ASSERT_EQ(0.5f, Variant(".5").value<float>());
+    ASSERT_TRUE(Variant("true").value<bool>());
+    ASSERT_FALSE(Variant("1").toBool());
+}
+
+TEST_F(variantTest, equalityAndHash)
+{
+    ASSERT_EQ(Variant(), Variant());
+    ASSERT_EQ(Variant(1), Variant(1));
+    ASSERT_NE(Variant(1), Variant(2));
+    ASSERT_NE(Variant(1), Variant(1.0));
+    ASSERT_EQ(Variant(0.0), Variant(-0.0));
+    ASSERT_EQ(Variant(0.0).hash(), Variant(-0.0).hash());
+    ASSERT_EQ(Variant("text"), Variant(std::string("text")));
+    ASSERT_NE(Variant(1).hash(), Variant(1.0).hash());
+    ASSERT_NE(Variant(std::vector<float>{ 1.0f }), Variant(std::vector<double>{ 1.0 }));
+
+    Variant a;
+    JSON::parse(a, "{\"name\": \"test\", \"values\": [1, 2.5, \"three\"], \"nested\": {\"flag\": true}}");
+
+    Variant b;
+    JSON::parse(b, "{\"nested\": {\"flag\": true}, \"values\": [1, 2.5, \"three\"], \"name\": \"test\"}");
+
+    ASSERT_EQ(a, b);
+    ASSERT_EQ(a.hash(), b.hash());
+    ASSERT_EQ(std::hash<Variant>()(a), std::hash<Variant>()(b));
+
+    (*b.asMap())["nested"] = Variant(false);
+    ASSERT_NE(a, b);
+    ASSERT_NE(a.hash(), b.hash());
+}
+
+TEST_F(variantTest, equalityNaN)
+{
+    const double nan = std::numeric_limits<double>::quiet_NaN();
+
+    // NaNs are equal to each other, so that copies are equal to their originals
+    Variant scalar(nan);
+    Variant scalarCopy = scalar;
+    ASSERT_EQ(scalar, scalarCopy);
+    ASSERT_EQ(Variant(nan), Variant(-nan));
+    ASSERT_EQ(Variant(nan).hash(), Variant(-nan).hash());
+    ASSERT_EQ(Variant(std::numeric_limits<float>::quiet_NaN()), Variant(std::numeric_limits<float>::quiet_NaN()));
+    ASSERT_NE(Variant(nan), Variant(0.0));
+
+    Variant packed(std::vector<double>{ 1.0, nan });
+    Variant packedCopy = packed;
+    ASSERT_EQ(packed, packedCopy);
+    ASSERT_EQ(packed.hash(), packedCopy.hash());
+    ASSERT_EQ(Variant(std::vector<float>{ std::numeric_limits<float>::quiet_NaN() }), Variant(std::vector<float>{ std::numeric_limits<float>::quiet_NaN() }));
+
+    // Shared and unshared copies behave the same
+    Variant array = Variant::array();
+    array.asArray()->push_back(nan);
+    Variant unshared = array;
+    array.share();
+    Variant shared = array;
+    ASSERT_EQ(array, shared);
+    ASSERT_EQ(array, unshared);
+    ASSERT_EQ(array.hash(), unshared.hash());
+}
+
+TEST_F(variantTest, cachedHash)
+{
+    Variant array = Variant::array();
+    array.asArray()->push_back(1);
+    array.share();
+
+    Variant copy = array;
+    const std::uint64_t hash = array.hash();
+
+    ASSERT_EQ(hash, copy.hash());
+    ASSERT_EQ(array, copy);
+
+    // Modifying a shared variant resets its cached hash
+    copy.asArray()->push_back(2);
+    ASSERT_NE(hash, copy.hash());
+    ASSERT_NE(array, copy);
+    ASSERT_EQ(hash, array.hash());
+
+    // Modifying a variant that is no longer shared resets its cached hash as well
+    copy.asArray()->pop_back();
+    ASSERT_EQ(hash, copy.hash());
+    ASSERT_EQ(array, copy);
+}
@@ -0,0 +1,127 @@
+
+#include <string>
+
+#include <gmock/gmock.h>
+
+#include <cppexpose/reflection/DynamicProperty.h>
+#include <cppexpose/reflection/Object.h>
+#include <cppexpose/reflection/Property.h>
+#include <cppexpose/variant/VariantView.h>
+
+
+using namespace cppexpose;
+
+
+class VariantViewTest : public testing::Test
+{
+public:
+    VariantViewTest()
+    {
+    }
+};
+
+
+TEST_F(VariantViewTest, viewVariant)
+{
+    Variant number(42);
+    VariantView view(number);
+
+    ASSERT_EQ(&number, view.variant());
+    ASSERT_TRUE(view.hasType<int>());
+    ASSERT_EQ(VariantType::Int, view.variantType());
+    ASSERT_EQ(42, view.value<int>());
+    ASSERT_EQ(42.0, view.value<double>());
+    ASSERT_EQ("42", view.value<std::string>());
+    ASSERT_EQ(number.ptr<int>(), view.ptr<int>());
+
+    // The view references the variant, it does not copy it
+    number = 23;
+    ASSERT_EQ(23, view.value<int>());
+
+    Variant array = Variant::array();
+    array.asArray()->push_back(1);
+    array.asArray()->push_back(2);
+
+    VariantView arrayView(array);
+    ASSERT_TRUE(arrayView.isVariantArray());
+    ASSERT_EQ(array.asArray(), arrayView.asArray());
+    ASSERT_EQ(std::vector<int>({ 1, 2 }), arrayView.toVector<int>());
+    ASSERT_EQ("[1,2]", arrayView.toJSON());
+
+    ASSERT_TRUE(VariantView().isNull());
+    ASSERT_TRUE(VariantView().value<std::string>().empty());
+}
+
+TEST_F(VariantViewTest, viewRawValues)
+{
+    const double number = 1.5;
+    const std::string str = "text";
+
+    VariantView numberView = VariantView::fromValue(number);
+    ASSERT_TRUE(numberView.hasType<double>());
+    ASSERT_TRUE(numberView.isFloatingPoint());
+    ASSERT_TRUE(typeid(double) == numberView.type());
+    ASSERT_EQ(&number, numberView.ptr<double>());
+    ASSERT_EQ(1, numberView.value<int>());
+    ASSERT_EQ(1.5f, numberView.value<float>());
+    ASSERT_TRUE(numberView.toVariant().hasType<double>());
+
+    VariantView stringView = VariantView::fromValue(str);
+    ASSERT_TRUE(stringView.isString());
+    ASSERT_EQ(&str, stringView.ptr<std::string>());
+    ASSERT_EQ("text", stringView.toString());
+    ASSERT_EQ(nullptr, stringView.ptr<int>());
+
+    // Raw values are converted like the values in a variant
+    const std::string numberString = "42.5";
+    VariantView numberStringView = VariantView::fromValue(numberString);
+    ASSERT_TRUE(typeid(std::string) == numberStringView.type());
+    ASSERT_TRUE(numberStringView.canConvert<int>());
+    ASSERT_EQ(Variant(numberString).value<int>(), numberStringView.value<int>());
+    ASSERT_EQ(42.5, numberStringView.toDouble());
+    ASSERT_EQ(Variant(number).toString(), numberView.toString());
+    ASSERT_EQ(Variant(true).toString(), VariantView::fromValue(true).toString());
+}
+
+TEST_F(VariantViewTest, viewTypedValues)
+{
+    DynamicProperty<int> dynamicProperty("dynamic", nullptr, 7);
+
+    VariantView dynamicView(dynamicProperty);
+    ASSERT_EQ(&dynamicProperty, dynamicView.typed());
+    ASSERT_TRUE(dynamicView.hasType<int>());
+    ASSERT_EQ(dynamicProperty.ptr(), dynamicView.ptr<int>());
+    ASSERT_EQ(7, dynamicView.value<int>());
+    ASSERT_EQ("7", dynamicView.value<std::string>());
+
+    // Values that are only accessible by a getter are converted
+    int value = 3;
+    Property<int> property("property", nullptr, [&value] () { return value; }, [&value] (const int & val) { value = val; });
+
+    VariantView propertyView(property);
+    ASSERT_TRUE(propertyView.hasType<int>());
+    ASSERT_EQ(nullptr, propertyView.ptr<int>());
+    ASSERT_EQ(3, propertyView.value<int>());
+    ASSERT_EQ(3.0, propertyView.value<double>());
+
+    // Typed values holding a variant are viewed like the variant
+    DynamicProperty<Variant> variantProperty("variant", nullptr, Variant(1.5f));
+
+    VariantView variantView(variantProperty);
+    ASSERT_EQ(variantProperty.ptr(), variantView.variant());
+    ASSERT_TRUE(variantView.hasType<float>());
+}
+
+TEST_F(VariantViewTest, walkObject)
+{
+    Object object("root");
+    DynamicProperty<int> a("a", &object, 1);
+    DynamicProperty<std::string> b("b", &object, "two");
+
+    VariantView view(static_cast<const AbstractTyped &>(object));
+    ASSERT_TRUE(view.isComposite());
+    ASSERT_EQ(2u, view.numSubValues());
+    ASSERT_EQ(1, view.subValue(0).value<int>());
+    ASSERT_EQ("two", view.subValue(1).value<std::string>());
+    ASSERT_TRUE(view.subValue(2).isNull());
+}